@@ -7,6 +7,8 @@
 //        Martin Vala (martin.vala@cern.ch)
 //
 
+#include <algorithm>
+
 #include <TFile.h>
 #include <TChain.h>
 #include <TChainElement.h>
@@ -37,13 +39,16 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fDoMixExtra(kTRUE),
    fDoMixIfNotEnoughEvents(kTRUE),
    fDoMixEventGetEntryAuto(kTRUE),
+   fDoMixInEntryOrder(kFALSE),
+   fMixCacheSize(0),
    fCurrentEntry(0),
    fCurrentEntryMain(0),
    fCurrentEntryMix(0),
    fCurrentBinIndex(-1),
    fOfflineTriggerMask(0),
    fCurrentMixEntry(),
-   fCurrentEntryMainTree(0)
+   fCurrentEntryMainTree(0),
+   fMixEntries()
 {
    //
    // Default constructor.
@@ -153,6 +158,7 @@ Bool_t AliMixInputEventHandler::Notify(const char *path)
    for (Int_t i = 0; i < fInputHandlers.GetEntries(); i++) {
       AliDebug(AliLog::kDebug + 5, Form("fInputHandlers[%d]", i));
       mixIHI = new AliMixInputHandlerInfo(fMixIntupHandlerInfoTmp->GetName(), fMixIntupHandlerInfoTmp->GetTitle());
+      mixIHI->SetCacheSize(fMixCacheSize);
       if (doPrepareEntry) mixIHI->PrepareEntry(che, -1, (AliInputEventHandler *)InputEventHandler(i), fAnalysisType);
       AliDebug(AliLog::kDebug + 5, Form("chain[%d]->GetEntries() = %lld", i, mixIHI->GetChain()->GetEntries()));
       fMixTrees.Add(mixIHI);
@@ -247,13 +253,19 @@ Bool_t AliMixInputEventHandler::MixStd()
    fNumberMixed = 0;
    AliMixInputHandlerInfo *mihi = 0;
    Long64_t entryMix = 0, entryMixReal = 0;
-   Int_t counter = 0;
+   Int_t counter = 0, nMix = 0;
+   if (mixNum > fMixEntries.GetSize()) fMixEntries.Set(mixNum);
    for (counter = 0; counter < mixNum; counter++) {
       entryMix = fEntryCounter - 1 - counter ;
       AliDebug(AliLog::kDebug + 5, Form("Handler[%d] entryMix %lld ", counter, entryMix));
       if (entryMix < 0) break;
+      fMixEntries[nMix++] = entryMix;
+   }
+   mihi = (AliMixInputHandlerInfo *) fMixTrees.At(0);
+   if (fDoMixInEntryOrder) OrderMixEntries(nMix, mihi);
+   for (counter = 0; counter < nMix; counter++) {
+      entryMix = fMixEntries[counter];
       entryMixReal = entryMix;
-      mihi = (AliMixInputHandlerInfo *) fMixTrees.At(0);
       TChainElement *te = fMixIntupHandlerInfoTmp->GetEntryInTree(entryMix);
       if (!te) {
          AliError("te is null. this is error. tell to developer (#1)");
@@ -455,16 +467,24 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    AliMixInputHandlerInfo *mihi = 0;
    Long64_t entryMix = 0, entryMixReal = 0;
    Int_t counter = 0;
+   Int_t nMix = 0;
    mihi = (AliMixInputHandlerInfo *) fMixTrees.At(0);
-   // fills num for main events
+   // partners from the most recent one
+   if (mixNum > fMixEntries.GetSize()) fMixEntries.Set(mixNum);
    for (counter = 0; counter < mixNum; counter++) {
-      fCurrentMixEntry.Reset();
       Long64_t entryInEntryList =  elNum - 2 - counter;
       AliDebug(AliLog::kDebug + 3, Form("entryInEntryList=%lld", entryInEntryList));
       if (entryInEntryList < 0) break;
       entryMix = el->GetEntry(entryInEntryList);
       AliDebug(AliLog::kDebug + 3, Form("entryMix=%lld", entryMix));
       if (entryMix < 0) break;
+      fMixEntries[nMix++] = entryMix;
+   }
+   if (fDoMixInEntryOrder) OrderMixEntries(nMix, mihi);
+   // fills num for main events
+   for (counter = 0; counter < nMix; counter++) {
+      fCurrentMixEntry.Reset();
+      entryMix = fMixEntries[counter];
       entryMixReal = entryMix;
       TChainElement *te = fMixIntupHandlerInfoTmp->GetEntryInTree(entryMix);
       if (!te) {
@@ -518,6 +538,28 @@ void AliMixInputEventHandler::AddInputEventHandler(AliVEventHandler *)
    AliWarning("Use AliMixEventInputHandler::SetInputHandlerForMixing instead. Exiting ...");
 }
 
+//_____________________________________________________________________________
+void AliMixInputEventHandler::OrderMixEntries(Int_t n, AliMixInputHandlerInfo *mihi)
+{
+   //
+   // Orders first n partner entries in fMixEntries by chain entry, starting
+   // with the entries of the file which is open in mihi, so that partners
+   // are read without changing file and in basket order
+   //
+   if (n < 2) return;
+   Long64_t *entries = fMixEntries.GetArray();
+   std::sort(entries, entries + n);
+   if (!mihi) return;
+   Long64_t entryInTree = 0;
+   for (Int_t i = 0; i < n; i++) {
+      entryInTree = entries[i];
+      if (mihi->IsCurrentFile(fMixIntupHandlerInfoTmp->GetEntryInTree(entryInTree))) {
+         std::rotate(entries, entries + i, entries + n);
+         return;
+      }
+   }
+}
+
 //_____________________________________________________________________________
 void AliMixInputEventHandler::UserExecMixAllTasks(Long64_t entryCounter, Int_t idEntryList, Long64_t entryMainReal, Long64_t entryMixReal, Int_t numMixed)
 {
@@ -13,6 +13,7 @@
 #include <TObjArray.h>
 #include <TEntryList.h>
 #include <TArrayI.h>
+#include <TArrayL64.h>
 
 #include <AliVEvent.h>
 
@@ -70,6 +71,10 @@ public:
    Bool_t                  IsMixingIfNotEnoughEvents() { return fDoMixIfNotEnoughEvents;}
 
    void                    DoMixEventGetEntryAuto(Bool_t doAuto=kTRUE) { fDoMixEventGetEntryAuto = doAuto; }
+   void                    SetMixCacheSize(Long64_t size) { fMixCacheSize = size; }
+   void                    DoMixInEntryOrder(Bool_t b = kTRUE) { fDoMixInEntryOrder = b; }
+   Long64_t                MixCacheSize() const { return fMixCacheSize; }
+   Bool_t                  IsMixingInEntryOrder() const { return fDoMixInEntryOrder; }
 
    Bool_t                  GetEntryMainEvent();
    Bool_t                  GetEntryMixedEvent(Int_t idHandler=0);
@@ -89,6 +94,8 @@ private:
    Bool_t                  fDoMixExtra;            // mix extra events to get enough combinations
    Bool_t                  fDoMixIfNotEnoughEvents;// mix events if they don't have enough events to mix
    Bool_t                  fDoMixEventGetEntryAuto;// flag for preparing mixed events automatically (default on)
+   Bool_t                  fDoMixInEntryOrder;     // mix partners in chain entry order starting in the open file (default off)
+   Long64_t                fMixCacheSize;          // size of the tree cache of the mixing chains (0 = ROOT default)
 
    // mixing info
    Long64_t fCurrentEntry;       //! current entry number (adds 1 for every event processed on each worker)
@@ -99,18 +106,20 @@ private:
 
    TEntryList fCurrentMixEntry;    //! array of mix entries currently used (user should touch)
    Long64_t fCurrentEntryMainTree; //! current entry in current tree (main event)
+   TArrayL64 fMixEntries;          //! partner entries of the current event
 
    virtual Bool_t          MixStd();
    virtual Bool_t          MixBuffer();
    virtual Bool_t          MixEventsMoreTimesWithOneEvent();
    virtual Bool_t          MixEventsMoreTimesWithBuffer();
 
+   void                    OrderMixEntries(Int_t n, AliMixInputHandlerInfo *mihi);
    void                    UserExecMixAllTasks(Long64_t entryCounter, Int_t idEntryList, Long64_t entryMainReal, Long64_t entryMixReal, Int_t numMixed);
 
    AliMixInputEventHandler(const AliMixInputEventHandler &handler);
    AliMixInputEventHandler &operator=(const AliMixInputEventHandler &handler);
 
-   ClassDef(AliMixInputEventHandler, 5)
+   ClassDef(AliMixInputEventHandler, 6)
 };
 
 #endif
@@ -24,7 +24,8 @@ AliMixInputHandlerInfo::AliMixInputHandlerInfo(const char *name, const char *tit
    fChain(0),
    fChainEntriesArray(),
    fZeroEntryNumber(0),
-   fNeedNotify(kFALSE)
+   fNeedNotify(kFALSE),
+   fCacheSize(0)
 {
    //
    // Default constructor.
@@ -130,6 +131,7 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
       if (!fChain) {
          fChain = new TChain(te->GetName());
          fChain->AddFile(te->GetTitle());
+         if (fCacheSize > 0) fChain->SetCacheSize(fCacheSize);
          fChain->GetEntry(0);
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
@@ -148,6 +150,7 @@ void AliMixInputHandlerInfo::PrepareEntry(TChainElement *te, Long64_t entry, Ali
          delete fChain;
          fChain = new TChain(te->GetName());
          fChain->AddFile(te->GetTitle());
+         if (fCacheSize > 0) fChain->SetCacheSize(fCacheSize);
          fChain->GetEntry(0);
          eh->Init(opt);
          eh->Init(fChain->GetTree(), opt);
@@ -180,3 +183,15 @@ Long64_t AliMixInputHandlerInfo::GetEntries()
    if (fChain) return fChain->GetEntries();
    return -1;
 }
+
+//_____________________________________________________________________________
+Bool_t AliMixInputHandlerInfo::IsCurrentFile(const TChainElement *te) const
+{
+   //
+   // Returns kTRUE when te is the file currently open in chain
+   // (its entries are read without changing file)
+   //
+   if (!te || !fChain || !fChain->GetTree() || !fChain->GetTree()->GetCurrentFile()) return kFALSE;
+   TString fn = fChain->GetTree()->GetCurrentFile()->GetName();
+   return !fn.CompareTo(te->GetTitle());
+}
@@ -33,16 +33,21 @@ public:
    TChainElement *GetEntryInTree(Long64_t &entry);
    Long64_t      GetEntries();
 
+   void SetCacheSize(Long64_t size) { fCacheSize = size; }
+   Long64_t GetCacheSize() const { return fCacheSize; }
+   Bool_t IsCurrentFile(const TChainElement *te) const;
+
 private:
    TChain    *fChain;              // current chain
    TArrayI   fChainEntriesArray;   // array of entries of every chaing
    Long64_t  fZeroEntryNumber;     // zero entry number (will be used when we will delete not needed chains)
    Bool_t    fNeedNotify;          // flag if Notify is needed for current input handler
+   Long64_t  fCacheSize;           // size of the tree cache of the chain (0 = ROOT default)
 
    AliMixInputHandlerInfo(const AliMixInputHandlerInfo &handler);
    AliMixInputHandlerInfo &operator=(const AliMixInputHandlerInfo &handler);
 
-   ClassDef(AliMixInputHandlerInfo, 1); // Mix Input Handler info
+   ClassDef(AliMixInputHandlerInfo, 2); // Mix Input Handler info
 };
 
 #endif // ALIMIXINPUTHANDLERINFO_H
@@ -25,13 +25,27 @@
 #include "AliKMeansClustering.h"
 #include <TMath.h>
 #include <TRandom.h>
-#include <TH1F.h>
+#include <string.h>
 
 ClassImp(AliKMeansClustering)
 
 Double_t AliKMeansClustering::fBeta = 10.;
+Double_t AliKMeansClustering::fRTol = 0.;
 
  
+//
+// The responsibilities are stored cluster by cluster, r[i * n + j] for cluster i and
+// data point j, such that the loops over the data points run over contiguous memory
+// and can be vectorised by the compiler.
+//
+
+static inline Double_t PhiDistance(Double_t phi1, Double_t phi2)
+{
+    // distance in phi on the cylinder (phi defined mod 2 pi)
+    Double_t dx = TMath::Abs(phi1 - phi2);
+    return (dx > TMath::Pi()) ? 2. * TMath::Pi() - dx : dx;
+}
+
 Int_t AliKMeansClustering::SoftKMeans(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my , Double_t* rk )
 {
     //
@@ -48,76 +62,45 @@ Int_t AliKMeansClustering::SoftKMeans(Int_t k, Int_t n, const Double_t* x, const
 
     //
     // (2a) The responsibilities
-    Double_t** r = new Double_t*[n]; // responsibilities
-    for (j = 0; j < n; j++) {r[j] = new Double_t[k];}
+    Double_t* r    = new Double_t[k * n];
+    Double_t* rOld = (fRTol > 0.) ? new Double_t[k * n]() : 0;
     //
     // (2b) Normalisation
     Double_t* nr   = new Double_t[n];
     // (3) Iterations
     Int_t nit = 0;
-    
+
     while(1) {
 	nit++;
       //
       // Assignment step
       //
-      for (j = 0; j < n; j++) {
-	nr[j] = 0.;
-	for (i = 0; i < k; i++) {
-	  r[j][i] = TMath::Exp(- fBeta * d(mx[i], my[i], x[j], y[j]));
-	  nr[j] += r[j][i];
-	} // mean i
-      } // data point j
-	
-      for (j = 0; j < n; j++) {
-	for (i = 0; i < k; i++) {
-	  r[j][i] /=  nr[j];
-	} // mean i
-      } // data point j
-      
+      for (i = 0; i < k; i++) {
+	Double_t* ri = r + i * n;
+	for (j = 0; j < n; j++) {
+	  Double_t dx = PhiDistance(mx[i], x[j]);
+	  Double_t dy = my[i] - y[j];
+	  ri[j] = TMath::Exp(- fBeta * 0.5 * (dx * dx + dy * dy));
+	} // data point j
+      } // mean i
+      // no previous responsibilities in the first iteration
+      Double_t dr = NormaliseResponsibilities(k, n, r, nr, rOld);
+      if (nit == 1) dr = 1.;
 	//
 	// Update step
-      Double_t di = 0;
-      
-      for (i = 0; i < k; i++) {
-	  Double_t oldx = mx[i];
-	  Double_t oldy = my[i];
-	  
-	  mx[i] = x[0];
-	  my[i] = y[0];
-	  rk[i] = r[0][i];
-	
-	for (j = 1; j < n; j++) {
-	    Double_t xx =  x[j];
-//
-// Here we have to take into acount the cylinder topology where phi is defined mod 2xpi
-// If two coordinates are separated by more than pi in phi one has to be shifted by +/- 2 pi
-
-	    Double_t dx = mx[i] - x[j];
-	    if (dx >  TMath::Pi()) xx += 2. * TMath::Pi();
-	    if (dx < -TMath::Pi()) xx -= 2. * TMath::Pi();
-	    mx[i] = mx[i] * rk[i] + r[j][i] * xx;
-	    my[i] = my[i] * rk[i] + r[j][i] * y[j];
-	    rk[i] += r[j][i];
-	    mx[i] /= rk[i];
-	    my[i] /= rk[i];	    
-	    if (mx[i] > 2. * TMath::Pi()) mx[i] -= 2. * TMath::Pi();
-	    if (mx[i] < 0.              ) mx[i] += 2. * TMath::Pi();
-	} // Data
-	di += d(mx[i], my[i], oldx, oldy);
-      } // means 
+      Double_t di = UpdateMeans(k, n, x, y, r, mx, my, rk, -1.);
 	//
 	// ending condition
-      if (di < 1.e-8 || nit > 1000) break;
+      if (di < 1.e-8 || (rOld && dr < fRTol) || nit > 1000) break;
     } // while
 
-// Clean-up    
+// Clean-up
     delete[] nr;
-    for (j = 0; j < n; j++) delete[] r[j];
     delete[] r;
-// 
+    delete[] rOld;
+//
     return (nit < 1000);
-    
+
 }
 
 Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t* y, Double_t* mx, Double_t* my , Double_t* sigma2, Double_t* rk )
@@ -125,43 +108,56 @@ Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t*
     //
     // The soft K-means algorithm
     //
-    Int_t i,j;
-    //
     // (1) Initialisation of the k means using k-means++ recipe
-    // 
-     OptimalInit(k, n, x, y, mx, my);
     //
-    // (2a) The responsibilities
-    Double_t** r = new Double_t*[n]; // responsibilities
-    for (j = 0; j < n; j++) {r[j] = new Double_t[k];}
+    OptimalInit(k, n, x, y, mx, my);
     //
-    // (2b) Normalisation
+    // (2) The responsibilities, normalisation and weights
+    Double_t* r  = new Double_t[k * n];
     Double_t* nr = new Double_t[n];
-    //
-    // (2c) Weights 
     Double_t* pi = new Double_t[k];
     //
+    // (3) Iterations
+    Int_t ok = SoftKMeans2Iterate(k, n, x, y, mx, my, sigma2, rk, r, nr, pi);
+
+// Clean-up
+    delete[] nr;
+    delete[] pi;
+    delete[] r;
+//
+    return ok;
+}
+
+Int_t AliKMeansClustering::SoftKMeans2Iterate(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my,
+					      Double_t* sigma2, Double_t* rk, Double_t* r, Double_t* nr, Double_t* pi)
+{
+    //
+    // Iterations of SoftKMeans2 starting from the means mx, my.
+    // r (k * n), nr (n) and pi (k) are work arrays.
     //
-    // (2d) Initialise the responsibilties and weights
-    for (j = 0; j < n; j++) {
-      nr[j] = 0.;
-      for (i = 0; i < k; i++) {
-	r[j][i] = TMath::Exp(- fBeta * d(mx[i], my[i], x[j], y[j]));
-	nr[j] += r[j][i];
-      } // mean i
-    } // data point j
-    
+    Int_t i,j;
+    Double_t* rOld = (fRTol > 0.) ? new Double_t[k * n]() : 0;
+    //
+    // Initialise the responsibilties and weights
     for (i = 0; i < k; i++) {
-      rk[i]    = 0.;
-      sigma2[i] = 1./fBeta;
- 
+      Double_t* ri = r + i * n;
       for (j = 0; j < n; j++) {
-	r[j][i] /=  nr[j];
-	rk[i] += r[j][i];
-      } // mean i
+	Double_t dx = PhiDistance(mx[i], x[j]);
+	Double_t dy = my[i] - y[j];
+	ri[j] = TMath::Exp(- fBeta * 0.5 * (dx * dx + dy * dy));
+      } // data point j
+    } // mean i
+    NormaliseResponsibilities(k, n, r, nr, 0);
+    if (rOld) memcpy(rOld, r, k * n * sizeof(Double_t));
+
+    for (i = 0; i < k; i++) {
+      const Double_t* ri = r + i * n;
+      rk[i]     = 0.;
+      sigma2[i] = 1./fBeta;
+      for (j = 0; j < n; j++) rk[i] += ri[j];
       pi[i] = rk[i] / Double_t(n);
-    } // data point j
-    // (3) Iterations
+    } // mean i
+    // Iterations
     Int_t nit = 0;
 
     while(1) {
@@ -169,82 +165,46 @@ Int_t AliKMeansClustering::SoftKMeans2(Int_t k, Int_t n, Double_t* x, Double_t*
       //
       // Assignment step
       //
-      for (j = 0; j < n; j++) {
-	nr[j] = 0.;
-	for (i = 0; i < k; i++) {
-	  r[j][i] = pi[i] * TMath::Exp(- d(mx[i], my[i], x[j], y[j]) / sigma2[i] ) 
-	    / (2. * sigma2[i] * TMath::Pi() * TMath::Pi());
-	  nr[j] += r[j][i];
-	} // mean i
-      } // data point j
-	
       for (i = 0; i < k; i++) {
+	const Double_t norm = pi[i] / (2. * sigma2[i] * TMath::Pi() * TMath::Pi());
+	const Double_t c    = 0.5 / sigma2[i];
+	Double_t* ri = r + i * n;
 	for (j = 0; j < n; j++) {
-	  r[j][i] /=  nr[j];
-	} // mean i
-      } // data point j
-      
+	  Double_t dx = PhiDistance(mx[i], x[j]);
+	  Double_t dy = my[i] - y[j];
+	  ri[j] = norm * TMath::Exp(- c * (dx * dx + dy * dy));
+	} // data point j
+      } // mean i
+      Double_t dr = NormaliseResponsibilities(k, n, r, nr, rOld);
 	//
 	// Update step
-      Double_t di = 0;
-      
-      for (i = 0; i < k; i++) {
-	  Double_t oldx = mx[i];
-	  Double_t oldy = my[i];
-	  
-	  mx[i] = x[0];
-	  my[i] = y[0];
-	  rk[i] = r[0][i];
-	for (j = 1; j < n; j++) {
-	    Double_t xx =  x[j];
-//
-// Here we have to take into acount the cylinder topology where phi is defined mod 2xpi
-// If two coordinates are separated by more than pi in phi one has to be shifted by +/- 2 pi
-
-	    Double_t dx = mx[i] - x[j];
-	    if (dx >  TMath::Pi()) xx += 2. * TMath::Pi();
-	    if (dx < -TMath::Pi()) xx -= 2. * TMath::Pi();
-	    if (r[j][i] > 1.e-15) {
-	      mx[i] = mx[i] * rk[i] + r[j][i] * xx;
-	      my[i] = my[i] * rk[i] + r[j][i] * y[j];
-	      rk[i] += r[j][i];
-	      mx[i] /= rk[i];
-	      my[i] /= rk[i];	
-	    }    
-	    if (mx[i] > 2. * TMath::Pi()) mx[i] -= 2. * TMath::Pi();
-	    if (mx[i] < 0.              ) mx[i] += 2. * TMath::Pi();
-	} // Data
-	di += d(mx[i], my[i], oldx, oldy);
-
-      } // means 
+      Double_t di = UpdateMeans(k, n, x, y, r, mx, my, rk, 1.e-15);
       //
       // Sigma
       for (i = 0; i < k; i++) {
-	sigma2[i] = 0.;
+	const Double_t* ri = r + i * n;
+	Double_t s2 = 0.;
 	for (j = 0; j < n; j++) {
-	  sigma2[i] += r[j][i] * d(mx[i], my[i], x[j], y[j]);
+	  Double_t dx = PhiDistance(mx[i], x[j]);
+	  Double_t dy = my[i] - y[j];
+	  s2 += ri[j] * 0.5 * (dx * dx + dy * dy);
 	} // Data
-	sigma2[i] /= rk[i];
+	sigma2[i] = s2 / rk[i];
 	if (sigma2[i] < 0.0025) sigma2[i] = 0.0025;
-      } // Clusters    
+      } // Clusters
       //
       // Fractions
       for (i = 0; i < k; i++) pi[i] = rk[i] / Double_t(n);
       //
 // ending condition
-      if (di < 1.e-8 || nit > 1000) break;
+      if (di < 1.e-8 || (rOld && dr < fRTol) || nit > 1000) break;
     } // while
 
-// Clean-up    
-    delete[] nr;
-    delete[] pi;
-    for (j = 0; j < n; j++) delete[] r[j];
-    delete[] r;
-// 
+    delete[] rOld;
     return (nit < 1000);
 }
 
-Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t* y, Double_t* mx, Double_t* my , 
+Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t* y, Double_t* mx, Double_t* my ,
 				       Double_t* sigmax2, Double_t* sigmay2, Double_t* rk )
 {
     //
@@ -253,41 +213,40 @@ Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t*
     Int_t i,j;
     //
     // (1) Initialisation of the k means using k-means++ recipe
-    // 
+    //
      OptimalInit(k, n, x, y, mx, my);
     //
     // (2a) The responsibilities
-    Double_t** r = new Double_t*[n]; // responsibilities
-    for (j = 0; j < n; j++) {r[j] = new Double_t[k];}
+    Double_t* r    = new Double_t[k * n];
+    Double_t* rOld = (fRTol > 0.) ? new Double_t[k * n]() : 0;
     //
     // (2b) Normalisation
     Double_t* nr = new Double_t[n];
     //
-    // (2c) Weights 
+    // (2c) Weights
     Double_t* pi = new Double_t[k];
     //
     //
     // (2d) Initialise the responsibilties and weights
-    for (j = 0; j < n; j++) {
-      nr[j] = 0.;
-      for (i = 0; i < k; i++) {
+    for (i = 0; i < k; i++) {
+      Double_t* ri = r + i * n;
+      for (j = 0; j < n; j++) {
+	Double_t dx = PhiDistance(mx[i], x[j]);
+	Double_t dy = my[i] - y[j];
+	ri[j] = TMath::Exp(- fBeta * 0.5 * (dx * dx + dy * dy));
+      } // data point j
+    } // mean i
+    NormaliseResponsibilities(k, n, r, nr, 0);
+    if (rOld) memcpy(rOld, r, k * n * sizeof(Double_t));
 
-	r[j][i] = TMath::Exp(- fBeta * d(mx[i], my[i], x[j], y[j]));
-	nr[j] += r[j][i];
-      } // mean i
-    } // data point j
-    
     for (i = 0; i < k; i++) {
+      const Double_t* ri = r + i * n;
       rk[i]    = 0.;
       sigmax2[i] = 1./fBeta;
       sigmay2[i] = 1./fBeta;
- 
-      for (j = 0; j < n; j++) {
-	r[j][i] /=  nr[j];
-	rk[i] += r[j][i];
-      } // mean i
+      for (j = 0; j < n; j++) rk[i] += ri[j];
       pi[i] = rk[i] / Double_t(n);
-    } // data point j
+    } // mean i
     // (3) Iterations
     Int_t nit = 0;
 
@@ -296,102 +255,134 @@ Int_t AliKMeansClustering::SoftKMeans3(Int_t k, Int_t n, Double_t* x, Double_t*
       //
       // Assignment step
       //
-      for (j = 0; j < n; j++) {
-	nr[j] = 0.;
-	for (i = 0; i < k; i++) {
-
-	  Double_t dx = TMath::Abs(mx[i]-x[j]);
-	  if (dx > TMath::Pi()) dx = 2. * TMath::Pi() - dx;
-	  Double_t dy = TMath::Abs(my[i]-y[j]);
-	  r[j][i] = pi[i] * TMath::Exp(-0.5 *  (dx * dx / sigmax2[i] + dy * dy / sigmay2[i])) 
-	    / (2. * TMath::Sqrt(sigmax2[i] * sigmay2[i]) * TMath::Pi() * TMath::Pi());
-	  nr[j] += r[j][i];
-	} // mean i
-      } // data point j
-	
       for (i = 0; i < k; i++) {
+	const Double_t norm = pi[i] / (2. * TMath::Sqrt(sigmax2[i] * sigmay2[i]) * TMath::Pi() * TMath::Pi());
+	const Double_t cx   = 0.5 / sigmax2[i];
+	const Double_t cy   = 0.5 / sigmay2[i];
+	Double_t* ri = r + i * n;
 	for (j = 0; j < n; j++) {
-	  r[j][i] /=  nr[j];
-	} // mean i
-      } // data point j
-      
+	  Double_t dx = PhiDistance(mx[i], x[j]);
+	  Double_t dy = my[i] - y[j];
+	  ri[j] = norm * TMath::Exp(- (cx * dx * dx + cy * dy * dy));
+	} // data point j
+      } // mean i
+      Double_t dr = NormaliseResponsibilities(k, n, r, nr, rOld);
 	//
 	// Update step
-      Double_t di = 0;
-      
-      for (i = 0; i < k; i++) {
-	  Double_t oldx = mx[i];
-	  Double_t oldy = my[i];
-	  
-	  mx[i] = x[0];
-	  my[i] = y[0];
-	  rk[i] = r[0][i];
-	for (j = 1; j < n; j++) {
-	    Double_t xx =  x[j];
-//
-// Here we have to take into acount the cylinder topology where phi is defined mod 2xpi
-// If two coordinates are separated by more than pi in phi one has to be shifted by +/- 2 pi
-
-	    Double_t dx = mx[i] - x[j];
-	    if (dx >  TMath::Pi()) xx += 2. * TMath::Pi();
-	    if (dx < -TMath::Pi()) xx -= 2. * TMath::Pi();
-	    if (r[j][i] > 1.e-15) {
-	      mx[i] = mx[i] * rk[i] + r[j][i] * xx;
-	      my[i] = my[i] * rk[i] + r[j][i] * y[j];
-	      rk[i] += r[j][i];
-	      mx[i] /= rk[i];
-	      my[i] /= rk[i];	
-	    }    
-	    if (mx[i] > 2. * TMath::Pi()) mx[i] -= 2. * TMath::Pi();
-	    if (mx[i] < 0.              ) mx[i] += 2. * TMath::Pi();
-	} // Data
-	di += d(mx[i], my[i], oldx, oldy);
-
-      } // means 
+      Double_t di = UpdateMeans(k, n, x, y, r, mx, my, rk, 1.e-15);
       //
       // Sigma
       for (i = 0; i < k; i++) {
-	sigmax2[i] = 0.;
-	sigmay2[i] = 0.;
-
+	const Double_t* ri = r + i * n;
+	Double_t sx2 = 0.;
+	Double_t sy2 = 0.;
 	for (j = 0; j < n; j++) {
-	  Double_t dx = TMath::Abs(mx[i]-x[j]);
-	  if (dx > TMath::Pi()) dx = 2. * TMath::Pi() - dx;
-	  Double_t dy = TMath::Abs(my[i]-y[j]);
-	  sigmax2[i] += r[j][i] * dx * dx;
-	  sigmay2[i] += r[j][i] * dy * dy;
+	  Double_t dx = PhiDistance(mx[i], x[j]);
+	  Double_t dy = my[i] - y[j];
+	  sx2 += ri[j] * dx * dx;
+	  sy2 += ri[j] * dy * dy;
 	} // Data
-	sigmax2[i] /= rk[i];
-	sigmay2[i] /= rk[i];
+	sigmax2[i] = sx2 / rk[i];
+	sigmay2[i] = sy2 / rk[i];
 	if (sigmax2[i] < 0.0025) sigmax2[i] = 0.0025;
 	if (sigmay2[i] < 0.0025) sigmay2[i] = 0.0025;
-      } // Clusters    
+      } // Clusters
       //
       // Fractions
       for (i = 0; i < k; i++) pi[i] = rk[i] / Double_t(n);
       //
 // ending condition
-      if (di < 1.e-8 || nit > 1000) break;
+      if (di < 1.e-8 || (rOld && dr < fRTol) || nit > 1000) break;
     } // while
 
-// Clean-up    
+// Clean-up
     delete[] nr;
     delete[] pi;
-    for (j = 0; j < n; j++) delete[] r[j];
     delete[] r;
-// 
+    delete[] rOld;
+//
     return (nit < 1000);
 }
 
+Double_t AliKMeansClustering::NormaliseResponsibilities(Int_t k, Int_t n, Double_t* r, Double_t* nr, Double_t* rOld)
+{
+    //
+    // Normalise the responsibilities of each data point to unity.
+    // If rOld is given, returns the largest change with respect to rOld
+    // and stores the new responsibilities in rOld.
+    //
+    Int_t i, j;
+    for (j = 0; j < n; j++) nr[j] = 0.;
+    for (i = 0; i < k; i++) {
+      const Double_t* ri = r + i * n;
+      for (j = 0; j < n; j++) nr[j] += ri[j];
+    }
+    for (i = 0; i < k; i++) {
+      Double_t* ri = r + i * n;
+      for (j = 0; j < n; j++) ri[j] /= nr[j];
+    }
+
+    Double_t dmax = 0.;
+    if (rOld) {
+      for (j = 0; j < k * n; j++) {
+	Double_t dr = TMath::Abs(r[j] - rOld[j]);
+	if (dr > dmax) dmax = dr;
+	rOld[j] = r[j];
+      }
+    }
+    return dmax;
+}
+
+Double_t AliKMeansClustering::UpdateMeans(Int_t k, Int_t n, const Double_t* x, const Double_t* y, const Double_t* r,
+					  Double_t* mx, Double_t* my, Double_t* rk, Double_t rMin)
+{
+    //
+    // Update step: weighted means of the data points, data points with
+    // a responsibility not above rMin are skipped. Returns the sum of the
+    // distances the means moved.
+    //
+    Double_t di = 0;
+
+    for (Int_t i = 0; i < k; i++) {
+	Double_t oldx = mx[i];
+	Double_t oldy = my[i];
+	const Double_t* ri = r + i * n;
+
+	mx[i] = x[0];
+	my[i] = y[0];
+	rk[i] = ri[0];
+	for (Int_t j = 1; j < n; j++) {
+	    Double_t xx =  x[j];
+//
+// Here we have to take into acount the cylinder topology where phi is defined mod 2xpi
+// If two coordinates are separated by more than pi in phi one has to be shifted by +/- 2 pi
+
+	    Double_t dx = mx[i] - x[j];
+	    if (dx >  TMath::Pi()) xx += 2. * TMath::Pi();
+	    if (dx < -TMath::Pi()) xx -= 2. * TMath::Pi();
+	    if (ri[j] > rMin) {
+	      mx[i] = mx[i] * rk[i] + ri[j] * xx;
+	      my[i] = my[i] * rk[i] + ri[j] * y[j];
+	      rk[i] += ri[j];
+	      mx[i] /= rk[i];
+	      my[i] /= rk[i];
+	    }
+	    if (mx[i] > 2. * TMath::Pi()) mx[i] -= 2. * TMath::Pi();
+	    if (mx[i] < 0.              ) mx[i] += 2. * TMath::Pi();
+	} // Data
+	di += d(mx[i], my[i], oldx, oldy);
+    } // means
+    return di;
+}
+
 Double_t AliKMeansClustering::d(Double_t mx, Double_t my, Double_t x, Double_t y)
 {
     //
-    // Distance definition 
+    // Distance definition
     // Quasi - Euclidian on the eta-phi cylinder
-    
-    Double_t dx = TMath::Abs(mx-x);
-    if (dx > TMath::Pi()) dx = 2. * TMath::Pi() - dx;
-    
+
+    Double_t dx = PhiDistance(mx, x);
+
     return (0.5*(dx * dx + (my - y) * (my - y)));
 }
 
@@ -399,17 +390,25 @@ Double_t AliKMeansClustering::d(Double_t mx, Double_t my, Double_t x, Double_t y
 
 void AliKMeansClustering::OptimalInit(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my)
 {
-  //  
+  //
   // Optimal initialisation using the k-means++ algorithm
   // http://en.wikipedia.org/wiki/K-means%2B%2B
   //
-  // k-means++ is an algorithm for choosing the initial values for k-means clustering in statistics and machine learning. 
+  // k-means++ is an algorithm for choosing the initial values for k-means clustering in statistics and machine learning.
   // It was proposed in 2007 by David Arthur and Sergei Vassilvitskii as an approximation algorithm for the NP-hard k-means problem---
   // a way of avoiding the sometimes poor clusterings found by the standard k-means algorithm.
   //
+  // The minimum distances are updated with the last chosen center only. As in the
+  // former histogram based implementation the sampling weights accumulate over the
+  // iterations, one random number is used per selected center.
   //
-  TH1F d2("d2", "", n, -0.5, Float_t(n)-0.5);
-  d2.Reset();
+  Double_t* dmin = new Double_t[n];
+  Double_t* w    = new Double_t[n];      // sampling weights
+  Double_t* d2   = new Double_t[n + 1];  // cumulative sampling weights
+  for (Int_t j = 0; j < n; j++) {
+    dmin[j] = 1.e10;
+    w[j]    = 0.;
+  }
 
   // (1) Chose first center as a random point among the input data.
   Int_t ir = Int_t(Float_t(n) * gRandom->Rndm());
@@ -420,23 +419,31 @@ void AliKMeansClustering::OptimalInit(Int_t k, Int_t n, const Double_t* x, const
   Int_t icl = 1;
   while(icl < k)
     {
-      // find min distance to existing clusters
+      // min distance to existing clusters
+      d2[0] = 0.;
       for (Int_t j = 0; j < n; j++) {
-	Double_t dmin = 1.e10;
-	for (Int_t i = 0; i < icl; i++) {
-	  Double_t dij = d(mx[i], my[i], x[j], y[j]);
-	  if (dij < dmin) dmin = dij;
-	} // clusters
-	d2.Fill(Float_t(j), dmin);
+	Double_t dij = d(mx[icl-1], my[icl-1], x[j], y[j]);
+	if (dij < dmin[j]) dmin[j] = dij;
+	w[j]   += dmin[j];
+	d2[j+1] = d2[j] + w[j];
       } // data points
       // select a new cluster from data points with probability ~d2
-      ir = Int_t(d2.GetRandom() + 0.5);
+      Double_t r1 = gRandom->Rndm();
+      ir = 0;
+      if (d2[n] > 0.) {
+	ir = TMath::BinarySearch(n, d2, r1 * d2[n]);
+	if (ir < 0)     ir = 0;
+	if (ir > n - 1) ir = n - 1;
+      }
       mx[icl] = x[ir];
       my[icl] = y[ir];
       icl++;
     } // icl
-}
 
+  delete[] dmin;
+  delete[] w;
+  delete[] d2;
+}
 
 ClassImp(AliKMeansResult)
 
@@ -27,9 +27,18 @@ class AliKMeansClustering : public TObject
 			   Double_t* sigmax2, Double_t* sigmay2, Double_t* rk );
   static void  OptimalInit(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my);
   static void  SetBeta(Double_t beta) {fBeta = beta;}
+  // Stop also if no responsibility changes by more than tol (0: only the movement of the means is used)
+  static void  SetResponsibilityTolerance(Double_t tol) {fRTol = tol;}
   static Double_t d(Double_t mx, Double_t my, Double_t x, Double_t y);
 protected:
+  static Int_t    SoftKMeans2Iterate(Int_t k, Int_t n, const Double_t* x, const Double_t* y, Double_t* mx, Double_t* my, 
+				     Double_t* sigma2, Double_t* rk, Double_t* r, Double_t* nr, Double_t* pi);
+  static Double_t NormaliseResponsibilities(Int_t k, Int_t n, Double_t* r, Double_t* nr, Double_t* rOld);
+  static Double_t UpdateMeans(Int_t k, Int_t n, const Double_t* x, const Double_t* y, const Double_t* r, 
+			      Double_t* mx, Double_t* my, Double_t* rk, Double_t rMin);
+
   static Double_t fBeta; // beta parameter
+  static Double_t fRTol; // convergence tolerance on the responsibilities
   
   ClassDef(AliKMeansClustering, 1)
 };
@@ -27,6 +27,8 @@
 // Versions V1 and V2 merged
 //---------------------------------------------------------------------
 
+#include <algorithm>
+
 #include <TH2F.h>
 #include <TMath.h>
 
@@ -215,6 +217,7 @@ void AliUA1JetFinder::FindJets()
     for(Int_t jpart = 0; jpart < nIn; jpart++){ // loop for all particles in array
       for(Int_t ijet=0; ijet<nJets; ijet++){
         Float_t deta = etaT[jpart] - etaJet[ijet];
+        if (TMath::Abs(deta) > rc) continue; // outside this cone anyway
         Float_t dphi = phiT[jpart] - phiJet[ijet];
         if (dphi < -TMath::Pi()) dphi= -dphi - 2.0 * TMath::Pi();
         if (dphi >  TMath::Pi()) dphi = 2.0 * TMath::Pi() - dphi;
@@ -249,6 +252,23 @@ void AliUA1JetFinder::FindJets()
   //////////////////////////
 
   Int_t nTracks = fCalTrkEvent->GetNCalTrkTracks();
+
+  // Track to jet reordering, done once: list of the tracks of every
+  // reordered jet, in increasing track index
+  Int_t jetRank[kMaxJets];
+  Int_t firstTrack[kMaxJets];
+  for(Int_t p = 0; p < nJets; p++) {
+    jetRank[idx[p]] = p;
+    firstTrack[p]   = -1;
+  }
+  Int_t* nextTrack = new Int_t[nTracks];
+  for(Int_t jpart = nTracks-1; jpart >= 0; jpart--) {
+    nextTrack[jpart] = -1;
+    if(injet[jpart] < 0 || injet[jpart] >= nJets) continue;
+    injetOk[jpart] = jetRank[injet[jpart]];
+    nextTrack[jpart] = firstTrack[injetOk[jpart]];
+    firstTrack[injetOk[jpart]] = jpart;
+  }
   
   for(Int_t kj=0; kj<nj; kj++)
     {
@@ -275,13 +295,9 @@ void AliUA1JetFinder::FindJets()
       jet.SetBgEnergy(etbgTotal,0.);
       if (fDebug>1) jet.Print(Form("%d",kj));
       
-      for(Int_t jpart = 0; jpart < nTracks; jpart++) { // loop for all particles in array
-        // Track to jet reordering
-        if(injet[jpart] == idx[kj]){
-          injetOk[jpart] = kj;
-        }
-        // Check if the particle belongs to the jet and add the ref
-        if(injetOk[jpart] == kj && fCalTrkEvent->GetCalTrkTrack(jpart)->GetCutFlag() == 1) {
+      for(Int_t jpart = firstTrack[kj]; jpart >= 0; jpart = nextTrack[jpart]) { // particles of this jet
+        // Check if the particle passed the cuts and add the ref
+        if(fCalTrkEvent->GetCalTrkTrack(jpart)->GetCutFlag() == 1) {
           jet.AddTrack(fCalTrkEvent->GetCalTrkTrack(jpart)->GetTrackObject());
 	}
       }
@@ -296,6 +312,7 @@ void AliUA1JetFinder::FindJets()
   delete[] phiT;
   delete[] injet;
   delete[] injetOk;
+  delete[] nextTrack;
   delete[] areaJet;
   delete[] areaJetOk;
 
@@ -308,18 +325,17 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
 {
   // Dump lego
   AliUA1JetHeader* header = (AliUA1JetHeader*) fHeader;
-  const Int_t nBinsMax = 120000; // we use a fixed array not to fragment memory 
  
   const Int_t nBinEta = header->GetLegoNbinEta();
   const Int_t nBinPhi = header->GetLegoNbinPhi();
-  if((nBinPhi*nBinEta)>nBinsMax){
-    AliError("Too many bins of the ETA-PHI histogram");
-  }
-
-  Float_t etCell[nBinsMax] = {0.};   //! Cell Energy
-  Float_t etaCell[nBinsMax] = {0.};  //! Cell eta
-  Float_t phiCell[nBinsMax] = {0.};  //! Cell phi
-  Short_t flagCell[nBinsMax] = {0}; //! Cell flag
+  const Int_t nBins   = nBinEta*nBinPhi;
+  if (nBins <= 0) return;
+
+  std::vector<Float_t> etCell(nBins, 0.);    // Cell Energy
+  std::vector<Float_t> etaCell(nBins, 0.);   // Cell eta
+  std::vector<Float_t> phiCell(nBins, 0.);   // Cell phi
+  std::vector<Short_t> flagCell(nBins, 0);   // Cell flag
+  std::vector<Int_t>   binCell(nBins, -1);   // lego bin -> cell
   
   Int_t nCell = 0;
   TAxis* xaxis = fLego->GetXaxis();
@@ -335,9 +351,12 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
       etaCell[nCell] = eta;
       phiCell[nCell] = phi;
       flagCell[nCell] = 0; //default
+      binCell[(i-1)*nBinPhi + (j-1)] = nCell;
       nCell++;
     }
   }
+  if (nCell == 0) return;
+
   // Parameters from header
   Float_t minmove = header->GetMinMove();
   Float_t maxmove = header->GetMaxMove();
@@ -351,9 +370,18 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
 
   // Run algorithm//
   
-  // Sort cells by et
-  Int_t index[nBinsMax];
-  TMath::Sort(nCell, etCell, index);
+  // Sort cells by et, keep the position of each cell in the sorted list
+  std::vector<Int_t> index(nCell);
+  std::vector<Int_t> rank(nCell);
+  TMath::Sort(nCell, &etCell[0], &index[0]);
+  for (Int_t icell = 0; icell < nCell; icell++) rank[index[icell]] = icell;
+
+  // cells close to a seed / cone axis, filled from the lego grid
+  std::vector<Int_t> nearCells;
+  std::vector<Int_t> nearRanks;
+  nearCells.reserve(nCell);
+  nearRanks.reserve(nCell);
+
   // variable used in centroide loop
   Float_t eta   = 0.0;
   Float_t phi   = 0.0;
@@ -390,9 +418,19 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
       etsb = ets;
       etasb = 0.0;
       phisb = 0.0;
-      for(Int_t kcell =0; kcell < nCell; kcell++)
+
+      // The centroid stays within maxmove of the seed while cells are
+      // added, so only cells within rc+maxmove of the seed can enter the
+      // cone. They are visited in the same (et ordered) sequence as in the
+      // full cell list.
+      GetCellsInCone(eta0, phi0, rc + maxmove, binCell, nearCells);
+      nearRanks.clear();
+      for (UInt_t k = 0; k < nearCells.size(); k++) nearRanks.push_back(rank[nearCells[k]]);
+      std::sort(nearRanks.begin(), nearRanks.end());
+
+      for(UInt_t kcell =0; kcell < nearRanks.size(); kcell++)
 	{
-	  Int_t lcell = index[kcell];
+	  Int_t lcell = index[nearRanks[kcell]];
 	  if(lcell == jcell) continue; // cell itself
 	  if(flagCell[lcell] != 0) continue; // cell used before
 	  if(etCell[lcell] > etCell[jcell]) continue; // can this happen
@@ -444,8 +482,12 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
       Int_t   nCellIn  = 0;
       rc = header->GetRadius();
 
-      for(Int_t ncell =0; ncell < nCell; ncell++)
+      // cells around the cone axis, in increasing cell index
+      GetCellsInCone(eta, phi, rc, binCell, nearCells);
+
+      for(UInt_t kcell =0; kcell < nearCells.size(); kcell++)
 	{
+	  Int_t ncell = nearCells[kcell];
 	  if(flagCell[ncell] != 0) continue; // cell used before
 	  //calculate dr
 	  deta = etaCell[ncell] - eta;
@@ -469,7 +511,9 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
       Double_t etcmin = etCone ;  // could be used etCone - etmin !!
       //decisions !! etbmax < etcmin
       
-      for(Int_t mcell =0; mcell < nCell; mcell++){
+      // only cells of this cone can carry the -1 flag
+      for(UInt_t kcell =0; kcell < nearCells.size(); kcell++){
+	Int_t mcell = nearCells[kcell];
 	if(flagCell[mcell] == -1){
 	  if(etbmax < etcmin)
 	    flagCell[mcell] = 1; //flag cell as used
@@ -506,6 +550,44 @@ void AliUA1JetFinder::RunAlgoritm(Float_t etbgTotal, Double_t dEtTotal, Int_t& n
 
 }
 
+//-----------------------------------------------------------------------
+void AliUA1JetFinder::GetCellsInCone(Float_t eta, Float_t phi, Float_t radius,
+				     const std::vector<Int_t>& binCell, std::vector<Int_t>& cells) const
+{
+  // Cells of the lego whose center may lie within radius of (eta,phi),
+  // in increasing cell index. The selection is a (slightly larger) superset
+  // of the cone, the exact distance is checked by the caller.
+  cells.clear();
+
+  TAxis* xaxis = fLego->GetXaxis();
+  TAxis* yaxis = fLego->GetYaxis();
+  const Int_t nBinEta = xaxis->GetNbins();
+  const Int_t nBinPhi = yaxis->GetNbins();
+  const Double_t r = radius + 1e-3; // margin for the single precision distances
+
+  Int_t iMin = xaxis->FindFixBin(eta - r);
+  Int_t iMax = xaxis->FindFixBin(eta + r);
+  if (iMin < 1) iMin = 1;
+  if (iMax > nBinEta) iMax = nBinEta;
+  if (iMin > iMax) return;
+
+  // phi bins close to phi, with the same wrapping as the cone distance
+  std::vector<Int_t> phiBins;
+  phiBins.reserve(nBinPhi);
+  for (Int_t j = 1; j <= nBinPhi; j++) {
+    Double_t dphi = TMath::Abs(yaxis->GetBinCenter(j) - phi);
+    if (dphi > TMath::Pi()) dphi = 2.0 * TMath::Pi() - dphi;
+    if (dphi <= r) phiBins.push_back(j);
+  }
+
+  for (Int_t i = iMin; i <= iMax; i++) {
+    for (UInt_t k = 0; k < phiBins.size(); k++) {
+      Int_t cell = binCell[(i-1)*nBinPhi + (phiBins[k]-1)];
+      if (cell >= 0) cells.push_back(cell);
+    }
+  }
+}
+
 //-----------------------------------------------------------------------
 void AliUA1JetFinder::Reset()
 {
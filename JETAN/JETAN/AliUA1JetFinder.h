@@ -16,6 +16,8 @@
 // Versions V1 and V2 merged
 //---------------------------------------------------------------------
 
+#include <vector>
+
 #include "AliJetFinder.h"
 
 class TH2F;
@@ -44,6 +46,9 @@ class AliUA1JetFinder : public AliJetFinder
   AliUA1JetFinder(const AliUA1JetFinder& rJetF1);
   AliUA1JetFinder& operator = (const AliUA1JetFinder& rhsf);
 
+  void GetCellsInCone(Float_t eta, Float_t phi, Float_t radius,
+		      const std::vector<Int_t>& binCell, std::vector<Int_t>& cells) const;
+
   TH2F*       fLego;          //  Lego Histo
 
   AliJetBkg*  fJetBkg;        //! pointer to bkg class
@@ -21,6 +21,7 @@
 
 #include "AliCentralitySelectionTask.h"
 
+#include <TChain.h>
 #include <TTree.h>
 #include <TList.h>
 #include <TH1F.h>
@@ -50,6 +51,7 @@
 #include "AliESDtrackCuts.h"
 #include "AliESDVertex.h"
 #include "AliCentrality.h"
+#include "AliOADBCache.h"
 #include "AliOADBCentrality.h"
 #include "AliOADBContainer.h"
 #include "AliMultiplicity.h"
@@ -84,6 +86,8 @@ AliAnalysisTaskSE(),
   fAnalysisInput("ESD"),
   fIsMCInput(kFALSE),
   fCurrentRun(-1),
+  fPrefetchOADB(kFALSE),
+  fOADBPrefetched(kFALSE),
   fUseScaling(0),
   fUseCleaning(0),
   fFillHistos(0),
@@ -354,6 +358,8 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const char *name):
   fAnalysisInput("ESD"),
   fIsMCInput(kFALSE),
   fCurrentRun(-1),
+  fPrefetchOADB(kFALSE),
+  fOADBPrefetched(kFALSE),
   fUseScaling(0),
   fUseCleaning(0),
   fFillHistos(0),
@@ -634,6 +640,8 @@ AliCentralitySelectionTask::AliCentralitySelectionTask(const AliCentralitySelect
   fAnalysisInput(ana.fAnalysisInput),
   fIsMCInput(ana.fIsMCInput),
   fCurrentRun(ana.fCurrentRun),
+  fPrefetchOADB(ana.fPrefetchOADB),
+  fOADBPrefetched(kFALSE),
   fUseScaling(ana.fUseScaling),
   fUseCleaning(ana.fUseCleaning),
   fFillHistos(ana.fFillHistos),
@@ -1991,6 +1999,26 @@ void AliCentralitySelectionTask::Terminate(Option_t */*option*/)
 {
   // Terminate analysis
 }
+//________________________________________________________________________
+Bool_t AliCentralitySelectionTask::UserNotify()
+{
+  // On the first file, resolve the centrality OADB objects of all the runs
+  // of the input chain, so that the run switches do not read the OADB file
+
+  if (!fPrefetchOADB || fOADBPrefetched)
+    return kTRUE;
+  fOADBPrefetched = kTRUE;
+
+  TChain* chain = dynamic_cast<TChain*>(GetInputData(0));
+  if (!chain)
+    return kTRUE;
+  TString fileName =(Form("%s/COMMON/CENTRALITY/data/centrality.root", AliAnalysisManager::GetOADBPath()));
+  std::vector<Int_t> runs = AliOADBCache::GetRunsFromFileList(chain->GetListOfFiles());
+  Int_t nFound = AliOADBCache::Instance()->Prefetch(fileName,"Centrality",runs);
+  AliInfo(Form("Centrality OADB prefetched for %d of the %d runs of the input chain", nFound, (Int_t)runs.size()));
+  return kTRUE;
+}
+
 //________________________________________________________________________
 Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
 {
@@ -2008,14 +2036,17 @@ Int_t AliCentralitySelectionTask::SetupRun(const AliVEvent* const esd)
   TString fileName =(Form("%s/COMMON/CENTRALITY/data/centrality.root", AliAnalysisManager::GetOADBPath()));
   AliInfo(Form("Setup Centrality Selection for run %d with file %s\n",fCurrentRun,fileName.Data()));
 
-  AliOADBContainer *con = new AliOADBContainer("OADB");
-  con->InitFromFile(fileName,"Centrality");
-
+  // the container is shared with the other users of the OADB cache
+  AliOADBCache* cache = AliOADBCache::Instance();
   AliOADBCentrality*  centOADB = 0;
-  centOADB = (AliOADBCentrality*)(con->GetObject(fCurrentRun));
+  centOADB = (AliOADBCentrality*)(cache->GetObject(fileName,"Centrality",fCurrentRun));
   if (!centOADB) {
     AliWarning(Form("Centrality OADB does not exist for run %d, using Default \n",fCurrentRun ));
-    centOADB  = (AliOADBCentrality*)(con->GetDefaultObject("oadbDefault"));
+    centOADB  = (AliOADBCentrality*)(cache->GetObject(fileName,"Centrality",fCurrentRun,"oadbDefault"));
+  }
+  if (!centOADB) {
+    AliError(Form("Cannot fetch centrality OADB for run %d from %s", fCurrentRun, fileName.Data()));
+    return -1;
   }
 
   Bool_t isHijing=kFALSE;
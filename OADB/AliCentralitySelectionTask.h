@@ -33,10 +33,12 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   // Implementation of interface methods
   virtual void UserCreateOutputObjects();
   virtual void UserExec(Option_t *option);
+  virtual Bool_t UserNotify();
   virtual void Terminate(Option_t *option);
 
   void SetInput(const char* input)         {fAnalysisInput = input;}
   void SetMCInput()                        {fIsMCInput = kTRUE;}
+  void SetPrefetchOADB(Bool_t flag=kTRUE)  {fPrefetchOADB = flag;}
   void DontUseScaling()                    {fUseScaling=kFALSE;}  
   void DontUseCleaning()                   {fUseCleaning=kFALSE;}
   void SetFillHistos()                     {fFillHistos=kTRUE; DefineOutput(1, TList::Class());
@@ -53,6 +55,8 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TString  fAnalysisInput; 	// "ESD", "AOD"
   Bool_t   fIsMCInput;          // true when input is MC
   Int_t    fCurrentRun;         // current run number
+  Bool_t   fPrefetchOADB;       // resolve the OADB objects of all the runs of the input chain at the first file
+  Bool_t   fOADBPrefetched;     //! the OADB objects have been prefetched
   Bool_t   fUseScaling;         // flag to use scaling 
   Bool_t   fUseCleaning;        // flag to use cleaning  
   Bool_t   fFillHistos;         // flag to fill the QA histos
@@ -326,7 +330,7 @@ class AliCentralitySelectionTask : public AliAnalysisTaskSE {
   TH1F *fHOutVertex ;           //control histogram for vertex SPD
   TH1F *fHOutVertexT0 ;         //control histogram for vertex T0
 
-  ClassDef(AliCentralitySelectionTask, 31); 
+  ClassDef(AliCentralitySelectionTask, 32); 
 };
 
 #endif
@@ -12,6 +12,7 @@ using std::vector;
 #include <TH1I.h>
 #include <TH2D.h>
 #include <TH2F.h>
+#include <TTree.h>
 
 #include <AliAnalysisManager.h>
 #include <AliAODMCParticle.h>
@@ -126,24 +127,24 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     fFlag |= BIT(kTrigger);
 
   /// Vertex selection
+  /// The vertex related quantities are shared with the other instances through the event container
+  AliEventCutsContainer* cont = AliEventCutsContainer::GetContainer(ev);
+  cont->ComputeVertexQuantities(ev);
   const AliVVertex* vtTrc = ev->GetPrimaryVertex();
   const AliVVertex* vtSPD = ev->GetPrimaryVertexSPD();
-  const AliVVertex* &vtx = (vtTrc->GetNContributors() < 2) ? vtSPD : vtTrc;
-  double covTrc[6],covSPD[6];
-  vtTrc->GetCovarianceMatrix(covTrc);
-  vtSPD->GetCovarianceMatrix(covSPD);
-  double dz = vtTrc->GetZ() - vtSPD->GetZ();
-  double errTot = TMath::Sqrt(covTrc[5]+covSPD[5]);
-  double errTrc = TMath::Sqrt(covTrc[5]);
+  const AliVVertex* &vtx = (cont->fVtxTrkContributors < 2) ? vtSPD : vtTrc;
+  double dz = cont->fVtxDeltaZ;
+  double errTot = TMath::Sqrt(cont->fVtxErrZTrk * cont->fVtxErrZTrk + cont->fVtxErrZSPD * cont->fVtxErrZSPD);
+  double errTrc = cont->fVtxErrZTrk;
   double nsigTot = TMath::Abs(dz) / errTot, nsigTrc = TMath::Abs(dz) / errTrc;
 
   /// Vertex position cut
   if (vtx->GetZ() >= fMinVtz && vtx->GetZ() <= fMaxVtz) fFlag |= BIT(kVertexPosition);
 
   /// Vertex quality cuts
-  if (((vtTrc->GetNContributors() >= 2 ||  !fRequireTrackVertex) && vtSPD->GetNContributors() >= 1) && // Check if SPD vertex is there and (if required) check if Track vertex is present.
+  if (((cont->fVtxTrkContributors >= 2 ||  !fRequireTrackVertex) && cont->fVtxSPDContributors >= 1) && // Check if SPD vertex is there and (if required) check if Track vertex is present.
       (TMath::Abs(dz) <= fMaxDeltaSpdTrackAbsolute && nsigTot <= fMaxDeltaSpdTrackNsigmaSPD && nsigTrc <= fMaxDeltaSpdTrackNsigmaTrack) && // discrepancy track-SPD vertex
-      (!vtSPD->IsFromVertexerZ() || TMath::Sqrt(covSPD[5]) <= fMaxResolutionSPDvertex)
+      (!cont->fVtxSPDIsVertexerZ || cont->fVtxErrZSPD <= fMaxResolutionSPDvertex)
      ) // quality cut on vertexer SPD z
     fFlag |= BIT(kVertexQuality);
   fPrimaryVertex = const_cast<AliVVertex*>(vtx);
@@ -157,8 +158,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   /// Centrality cuts:
   /// * Check for min and max centrality
   /// * Cross check correlation between two centrality estimators
-  AliVMultiplicity* mult = ev->GetMultiplicity();
-  const int ntrkl = mult->GetNumberOfTracklets();
+  const int ntrkl = cont->fNTracklets;
   if (fCentralityFramework) {
     if (fCentralityFramework == 2) {
       AliCentrality* cent = ev->GetCentrality();
@@ -315,59 +315,114 @@ string AliEventCuts::GetCentralityEstimator (unsigned int estimator) const {
 
 
 void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
-  AliEventCutsContainer* tmp_cont = static_cast<AliEventCutsContainer*>(ev->FindListObject("AliEventCutsContainer"));
-  if (tmp_cont) {
-    unsigned long evid = ((unsigned long)(ev->GetBunchCrossNumber()) << 32) + ev->GetTimeStamp();
-    fNewEvent = (tmp_cont->fEventId != evid);
-    tmp_cont->fEventId = evid;
-    //if (fNewEvent) ::Info("AliEventCuts::AcceptEvent","New event. %Lu", evid);
-    //else ::Info("AliEventCuts::AcceptEvent","Old event. %Lu", evid);
-
-    if (!fNewEvent) {
-      fContainer = *tmp_cont;
-      return;
-    }
-  } else tmp_cont = new AliEventCutsContainer;
+  AliEventCutsContainer* cont = AliEventCutsContainer::GetContainer(ev);
+  fNewEvent = !cont->IsComputed(AliEventCutsContainer::kTrackMultiplicity);
+  cont->ComputeTrackMultiplicity(ev);
+  fContainer = *cont;
+}
+
+/// Identifier of the collision, built from the period, orbit and bunch crossing numbers
+///
+unsigned long AliEventCutsContainer::GetEventId(AliVEvent *ev) {
+  return ((unsigned long)(ev->GetPeriodNumber()) << 36) + ((unsigned long)(ev->GetOrbitNumber()) << 12) + ev->GetBunchCrossNumber();
+}
+
+/// Entry read by the input handler, -1 if not available. Together with GetEventId it identifies
+/// also the events without period/orbit/bunch crossing information (e.g. MC productions)
+///
+long long AliEventCutsContainer::GetReadEntry() {
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  AliInputEventHandler* handl = mgr ? dynamic_cast<AliInputEventHandler*>(mgr->GetInputEventHandler()) : 0x0;
+  TTree* tree = handl ? handl->GetTree() : 0x0;
+  return tree ? tree->GetReadEntry() : -1;
+}
+
+/// Return the container attached to the event, creating it if needed. The stored quantities
+/// are invalidated when the event changes, so that they are recomputed on demand.
+///
+AliEventCutsContainer* AliEventCutsContainer::GetContainer(AliVEvent *ev, bool *newEvent) {
+  AliEventCutsContainer* cont = static_cast<AliEventCutsContainer*>(ev->FindListObject("AliEventCutsContainer"));
+  if (!cont) {
+    cont = new AliEventCutsContainer;
+    ev->AddObject(cont);
+  }
+  const unsigned long evid = GetEventId(ev);
+  const long long entry = GetReadEntry();
+  const bool isNew = (cont->fEventId != evid || cont->fReadEntry != entry || entry < 0);
+  if (isNew) {
+    cont->fEventId = evid;
+    cont->fReadEntry = entry;
+    cont->fComputed = 0u;
+  }
+  if (newEvent) *newEvent = isNew;
+  return cont;
+}
+
+/// Quantities related to the primary vertices, used by the vertex quality cuts
+///
+void AliEventCutsContainer::ComputeVertexQuantities(AliVEvent *ev) {
+  if (IsComputed(kVertexQuantities)) return;
+  const AliVVertex* vtTrc = ev->GetPrimaryVertex();
+  const AliVVertex* vtSPD = ev->GetPrimaryVertexSPD();
+  double covTrc[6],covSPD[6];
+  vtTrc->GetCovarianceMatrix(covTrc);
+  vtSPD->GetCovarianceMatrix(covSPD);
+  fVtxTrkContributors = vtTrc->GetNContributors();
+  fVtxSPDContributors = vtSPD->GetNContributors();
+  fVtxSPDIsVertexerZ = vtSPD->IsFromVertexerZ();
+  fVtxDeltaZ = vtTrc->GetZ() - vtSPD->GetZ();
+  fVtxErrZTrk = TMath::Sqrt(covTrc[5]);
+  fVtxErrZSPD = TMath::Sqrt(covSPD[5]);
+  AliVMultiplicity* mult = ev->GetMultiplicity();
+  fNTracklets = mult ? mult->GetNumberOfTracklets() : -1;
+  fComputed |= kVertexQuantities;
+}
+
+/// Track multiplicities used by the correlation (pile-up) cuts, computed in a single pass on the tracks.
+/// The track cuts are created once per process and shared by all the containers.
+///
+void AliEventCutsContainer::ComputeTrackMultiplicity(AliVEvent *ev) {
+  if (IsComputed(kTrackMultiplicity)) return;
 
   bool isAOD = false;
   if (dynamic_cast<AliAODEvent*>(ev))
     isAOD = true;
   else if (!dynamic_cast<AliESDEvent*>(ev))
-    AliFatal("I don't find the AOD event nor the ESD one, aborting.");
+    ::Fatal("AliEventCutsContainer::ComputeTrackMultiplicity","I don't find the AOD event nor the ESD one, aborting.");
 
-  std::unique_ptr<AliESDtrackCuts> FB32cuts{AliESDtrackCuts::GetStandardITSTPCTrackCuts2011()};
-  std::unique_ptr<AliESDtrackCuts> TPConlyCuts{AliESDtrackCuts::GetStandardTPCOnlyTrackCuts()};
+  static std::unique_ptr<AliESDtrackCuts> FB32cuts{AliESDtrackCuts::GetStandardITSTPCTrackCuts2011()};
+  static std::unique_ptr<AliESDtrackCuts> TPConlyCuts{AliESDtrackCuts::GetStandardTPCOnlyTrackCuts()};
 
   const int nTracks = ev->GetNumberOfTracks();
-  tmp_cont->fMultESD = (isAOD) ? ((AliAODHeader*)ev->GetHeader())->GetNumberOfESDTracks() : dynamic_cast<AliESDEvent*>(ev)->GetNumberOfTracks();
-  tmp_cont->fMultTrkFB32 = 0;
-  tmp_cont->fMultTrkFB32Acc = 0;
-  tmp_cont->fMultTrkFB32TOF = 0;
-  tmp_cont->fMultTrkTPC = 0;
+  fMultESD = (isAOD) ? ((AliAODHeader*)ev->GetHeader())->GetNumberOfESDTracks() : dynamic_cast<AliESDEvent*>(ev)->GetNumberOfTracks();
+  fMultTrkFB32 = 0;
+  fMultTrkFB32Acc = 0;
+  fMultTrkFB32TOF = 0;
+  fMultTrkTPC = 0;
   for (int it = 0; it < nTracks; it++) {
     if (isAOD) {
       AliAODTrack* trk = (AliAODTrack*)ev->GetTrack(it);
       if (!trk) continue;
       if (trk->TestFilterBit(32)) {
-        tmp_cont->fMultTrkFB32++;
+        fMultTrkFB32++;
         if ( TMath::Abs(trk->GetTOFsignalDz()) <= 10. && trk->GetTOFsignal() >= 12000. && trk->GetTOFsignal() <= 25000.)
-          tmp_cont->fMultTrkFB32TOF++;
+          fMultTrkFB32TOF++;
         if ((fabs(trk->Eta()) < 0.8) && (trk->GetTPCNcls() >= 70) && (trk->Pt() >= 0.2) && (trk->Pt() < 50))
-          tmp_cont->fMultTrkFB32Acc++;
+          fMultTrkFB32Acc++;
       }
       if (trk->TestFilterBit(128))
-        tmp_cont->fMultTrkTPC++;
+        fMultTrkTPC++;
     } else {
       AliESDtrack* esdTrack = (AliESDtrack*)ev->GetTrack(it);
       if (!esdTrack) continue;
 
       if (FB32cuts->AcceptTrack(esdTrack)) {
-        tmp_cont->fMultTrkFB32++;
+        fMultTrkFB32++;
         if (TMath::Abs(esdTrack->GetTOFsignalDz()) <= 10 && esdTrack->GetTOFsignal() >= 12000 && esdTrack->GetTOFsignal() <= 25000)
-          tmp_cont->fMultTrkFB32TOF++;
+          fMultTrkFB32TOF++;
 
         if ((TMath::Abs(esdTrack->Eta()) < 0.8) && (esdTrack->GetTPCNcls() > 70) && (esdTrack->Pt() > 0.2) && (esdTrack->Pt() < 50))
-          tmp_cont->fMultTrkFB32Acc++;
+          fMultTrkFB32Acc++;
       }
 
       /// TPC only tracks, with the same cuts of the filter bit 128
@@ -382,11 +437,10 @@ void AliEventCuts::ComputeTrackMultiplicity(AliVEvent *ev) {
         relate = tpcParam.RelateToVertexTPC((AliESDVertex*)ev->GetPrimaryVertexSPD(),ev->GetMagneticField(),kVeryBig, &exParam);
         if(!relate) continue;
       }
-      tmp_cont->fMultTrkTPC++;
+      fMultTrkTPC++;
     }
   }
-  ev->AddObject(tmp_cont);
-  fContainer = *tmp_cont;
+  fComputed |= kTrackMultiplicity;
 }
 
 void AliEventCuts::SetupRun2pp() {
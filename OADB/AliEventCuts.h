@@ -17,23 +17,58 @@ class TH1I;
 class TH2D;
 class TH2F;
 
+/// Event-scoped store of the derived quantities used by the event selection.
+/// It is attached to the event (AliVEvent::AddObject) and computed at most once
+/// per event, whatever the number of AliEventCuts instances (or other tasks)
+/// asking for it: use AliEventCutsContainer::GetContainer to access it.
 class AliEventCutsContainer : public TNamed {
   public:
+    enum ComputedQuantities {
+      kVertexQuantities = BIT(0),
+      kTrackMultiplicity = BIT(1)
+    };
+
     AliEventCutsContainer() : TNamed("AliEventCutsContainer","AliEventCutsContainer"),
     fEventId(0u),
+    fReadEntry(-1),
+    fComputed(0u),
     fMultESD(-1),
     fMultTrkFB32(-1),
     fMultTrkFB32Acc(-1),
     fMultTrkFB32TOF(-1),
-    fMultTrkTPC(-1) {}
-
-    unsigned long fEventId;
+    fMultTrkTPC(-1),
+    fNTracklets(-1),
+    fVtxTrkContributors(-1),
+    fVtxSPDContributors(-1),
+    fVtxSPDIsVertexerZ(false),
+    fVtxDeltaZ(0.),
+    fVtxErrZTrk(0.),
+    fVtxErrZSPD(0.) {}
+
+    static AliEventCutsContainer* GetContainer(AliVEvent *ev, bool *newEvent = 0x0);
+    static unsigned long          GetEventId(AliVEvent *ev);
+    static long long              GetReadEntry();
+
+    void ComputeVertexQuantities(AliVEvent *ev);
+    void ComputeTrackMultiplicity(AliVEvent *ev);
+    bool IsComputed(ComputedQuantities what) const { return fComputed & what; }
+
+    unsigned long fEventId;           ///< Period, orbit and bunch crossing of the event
+    long long fReadEntry;             ///< Entry of the input tree (distinguishes MC events without orbit/BC)
+    unsigned int fComputed;           ///< ComputedQuantities already filled for fEventId and fReadEntry
     int fMultESD;
     int fMultTrkFB32;
     int fMultTrkFB32Acc;
     int fMultTrkFB32TOF;
     int fMultTrkTPC;
-  ClassDef(AliEventCutsContainer,1)
+    int fNTracklets;                  ///< Number of SPD tracklets
+    int fVtxTrkContributors;          ///< Contributors to the track vertex
+    int fVtxSPDContributors;          ///< Contributors to the SPD vertex
+    bool fVtxSPDIsVertexerZ;          ///< The SPD vertex comes from the vertexer Z
+    double fVtxDeltaZ;                ///< z(track vertex) - z(SPD vertex)
+    double fVtxErrZTrk;               ///< Resolution on z of the track vertex
+    double fVtxErrZSPD;               ///< Resolution on z of the SPD vertex
+  ClassDef(AliEventCutsContainer,3)
 };
 
 class AliEventCuts : public TList {
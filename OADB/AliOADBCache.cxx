@@ -0,0 +1,277 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//     Process-wide cache of OADB containers
+//
+//     Many OADB consumers (centrality, physics selection, event plane, PID
+//     ...) used to create their own AliOADBContainer and open the OADB
+//     file at every run change. The cache keeps one copy of every
+//     (file, key) container per process, indexes its run ranges for a
+//     binary search and remembers the objects already resolved, e.g.:
+//
+//       TObject* obj = AliOADBCache::Instance()->GetObject(file, "Centrality", run, "oadbDefault");
+//
+//     The objects are shared between tasks and must be treated as const.
+//-------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include <TChain.h>
+#include <TCollection.h>
+#include <TDirectory.h>
+#include <TFile.h>
+#include <TH1.h>
+#include <TObjArray.h>
+#include <TObjString.h>
+#include <TPRegexp.h>
+#include <TSystem.h>
+
+#include "AliLog.h"
+#include "AliOADBContainer.h"
+#include "AliOADBCache.h"
+
+ClassImp(AliOADBCache)
+
+AliOADBCache* AliOADBCache::fgInstance = 0x0;
+
+//________________________________________________________________________
+AliOADBCache::AliOADBCache() : TObject(),
+  fFiles(),
+  fContainers()
+{
+  // ctor
+}
+
+//________________________________________________________________________
+AliOADBCache::~AliOADBCache()
+{
+  // dtor: the cache owns the containers and closes the files
+  for (std::map<std::string, Entry>::iterator it = fContainers.begin(); it != fContainers.end(); ++it)
+    delete it->second.fContainer;
+  fContainers.clear();
+  for (std::map<std::string, TFile*>::iterator it = fFiles.begin(); it != fFiles.end(); ++it) {
+    if (it->second) {
+      it->second->Close();
+      delete it->second;
+    }
+  }
+  fFiles.clear();
+}
+
+//________________________________________________________________________
+AliOADBCache* AliOADBCache::Instance()
+{
+  // singleton accessor
+  if (!fgInstance) fgInstance = new AliOADBCache();
+  return fgInstance;
+}
+
+//________________________________________________________________________
+void AliOADBCache::Reset()
+{
+  // drop all the cached containers and close the files. Pointers obtained
+  // before the reset become invalid.
+  delete fgInstance;
+  fgInstance = 0x0;
+}
+
+//________________________________________________________________________
+TFile* AliOADBCache::GetFile(const char* fileName)
+{
+  // open the file the first time it is needed, keep it open afterwards
+  TString path(fileName);
+  gSystem->ExpandPathName(path);
+  std::map<std::string, TFile*>::iterator it = fFiles.find(path.Data());
+  if (it != fFiles.end()) return it->second;
+
+  // TFile::Open makes the new file the current directory, restore the caller's one
+  TDirectory::TContext context(gDirectory);
+  TFile* file = TFile::Open(path);
+  if (!file || !file->IsOpen()) {
+    AliError(Form("Cannot open OADB file %s", path.Data()));
+    delete file;
+    file = 0x0;
+  }
+  // failures are remembered as well, not to retry at every run change
+  fFiles[path.Data()] = file;
+  return file;
+}
+
+//________________________________________________________________________
+AliOADBCache::Entry* AliOADBCache::GetEntry(const char* fileName, const char* key)
+{
+  // find or load the container stored under key
+  TString path(fileName);
+  gSystem->ExpandPathName(path);
+  std::string id = Form("%s#%s", path.Data(), key);
+  std::map<std::string, Entry>::iterator it = fContainers.find(id);
+  if (it != fContainers.end()) return it->second.fContainer ? &(it->second) : 0x0;
+
+  Entry& entry = fContainers[id];
+  TFile* file = GetFile(path);
+  if (!file) return 0x0;
+
+  Bool_t oldStatus = TH1::AddDirectoryStatus();
+  TH1::AddDirectory(kFALSE);
+  entry.fContainer = dynamic_cast<AliOADBContainer*>(file->Get(key));
+  TH1::AddDirectory(oldStatus);
+  if (!entry.fContainer) {
+    AliError(Form("Cannot fetch OADB container %s from %s", key, path.Data()));
+    return 0x0;
+  }
+  AliInfo(Form("Cached OADB container %s from %s (%d entries)", key, path.Data(),
+               entry.fContainer->GetNumberOfEntries()));
+  return &entry;
+}
+
+//________________________________________________________________________
+AliOADBContainer* AliOADBCache::GetContainer(const char* fileName, const char* key)
+{
+  // shared container stored under key in fileName
+  Entry* entry = GetEntry(fileName, key);
+  return entry ? entry->fContainer : 0x0;
+}
+
+//________________________________________________________________________
+const AliOADBCache::RunIndex& AliOADBCache::GetIndex(Entry& entry, const char* passName)
+{
+  // build (once) the run range index for the given pass name. Pass
+  // specific lookups are left to AliOADBContainer::GetObject (their result
+  // is cached anyway), only the pass independent case is indexed.
+  std::map<std::string, RunIndex>::iterator it = entry.fIndices.find(passName);
+  if (it != entry.fIndices.end()) return it->second;
+
+  RunIndex& index = entry.fIndices[passName];
+  AliOADBContainer* cont = entry.fContainer;
+  if (passName && passName[0]) {
+    index.fOverlapping = kTRUE;
+    return index;
+  }
+
+  std::vector<std::pair<Int_t, Int_t> > order;
+  for (Int_t i = 0; i < cont->GetNumberOfEntries(); ++i)
+    order.push_back(std::make_pair(cont->LowerLimit(i), i));
+  std::sort(order.begin(), order.end());
+
+  for (size_t i = 0; i < order.size(); ++i) {
+    const Int_t idx = order[i].second;
+    if (!index.fUpper.empty() && cont->LowerLimit(idx) <= index.fUpper.back())
+      index.fOverlapping = kTRUE;
+    index.fLower.push_back(cont->LowerLimit(idx));
+    index.fUpper.push_back(cont->UpperLimit(idx));
+    index.fEntry.push_back(idx);
+  }
+  if (index.fOverlapping)
+    AliWarning(Form("Overlapping run ranges in OADB container %s, using the linear search", cont->GetName()));
+  return index;
+}
+
+//________________________________________________________________________
+TObject* AliOADBCache::Lookup(Entry& entry, Int_t run, const char* def, const char* passName)
+{
+  // resolve the object for run, remembering the result
+  std::string id = Form("%d#%s#%s", run, def, passName);
+  std::map<std::string, TObject*>::iterator it = entry.fResolved.find(id);
+  if (it != entry.fResolved.end()) return it->second;
+
+  TObject* obj = 0x0;
+  const RunIndex& index = GetIndex(entry, passName);
+  if (index.fOverlapping) {
+    obj = entry.fContainer->GetObject(run, def, passName);
+  } else {
+    // last range starting at or before run
+    std::vector<Int_t>::const_iterator up = std::upper_bound(index.fLower.begin(), index.fLower.end(), run);
+    if (up != index.fLower.begin()) {
+      const size_t i = (up - index.fLower.begin()) - 1;
+      if (run <= index.fUpper[i]) obj = entry.fContainer->GetObjectByIndex(index.fEntry[i]);
+    }
+    if (!obj && def && def[0]) obj = entry.fContainer->GetDefaultObject(def);
+  }
+  entry.fResolved[id] = obj;
+  return obj;
+}
+
+//________________________________________________________________________
+TObject* AliOADBCache::GetObject(const char* fileName, const char* key, Int_t run,
+                                 const char* def, const char* passName)
+{
+  // shared object for run, see AliOADBContainer::GetObject
+  Entry* entry = GetEntry(fileName, key);
+  if (!entry) return 0x0;
+  return Lookup(*entry, run, def, passName);
+}
+
+//________________________________________________________________________
+Int_t AliOADBCache::Prefetch(const char* fileName, const char* key, const std::vector<Int_t>& runs,
+                             const char* def, const char* passName)
+{
+  // resolve the objects for all runs, returns the number of runs with an object
+  Entry* entry = GetEntry(fileName, key);
+  if (!entry) return 0;
+  Int_t found = 0;
+  for (size_t i = 0; i < runs.size(); ++i)
+    if (Lookup(*entry, runs[i], def, passName)) found++;
+  return found;
+}
+
+//________________________________________________________________________
+Int_t AliOADBCache::Prefetch(const char* fileName, const char* key, TChain* chain,
+                             const char* def, const char* passName)
+{
+  // resolve the objects for all the runs of the input chain
+  if (!chain) return 0;
+  return Prefetch(fileName, key, GetRunsFromFileList(chain->GetListOfFiles()), def, passName);
+}
+
+//________________________________________________________________________
+std::vector<Int_t> AliOADBCache::GetRunsFromFileList(TCollection* files)
+{
+  // sorted list of the distinct run numbers appearing in the file paths
+  std::vector<Int_t> runs;
+  if (!files) return runs;
+  TIter next(files);
+  while (TObject* file = next()) {
+    // chain elements keep the file name in the title
+    const Int_t run = GetRunFromPath(file->GetTitle()[0] ? file->GetTitle() : file->GetName());
+    if (run > 0) runs.push_back(run);
+  }
+  std::sort(runs.begin(), runs.end());
+  runs.erase(std::unique(runs.begin(), runs.end()), runs.end());
+  return runs;
+}
+
+//________________________________________________________________________
+Int_t AliOADBCache::GetRunFromPath(const char* path)
+{
+  // run number from the standard data (/000244918/) or MC (/244918/) path
+  TPRegexp re("/0*([1-9][0-9]{5})/");
+  TObjArray* match = re.MatchS(path);
+  Int_t run = -1;
+  if (match->GetEntriesFast() > 1)
+    run = static_cast<TObjString*>(match->At(1))->String().Atoi();
+  delete match;
+  return run;
+}
+
+//________________________________________________________________________
+void AliOADBCache::Print(Option_t* /*option*/) const
+{
+  // list the cached containers
+  printf("AliOADBCache: %d files, %d containers\n", GetNumberOfOpenFiles(), GetNumberOfContainers());
+  for (std::map<std::string, Entry>::const_iterator it = fContainers.begin(); it != fContainers.end(); ++it)
+    printf("  %s : %s, %d resolved lookups\n", it->first.c_str(),
+           it->second.fContainer ? "loaded" : "missing", (Int_t) it->second.fResolved.size());
+}
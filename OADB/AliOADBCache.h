@@ -0,0 +1,90 @@
+#ifndef AliOADBCache_H
+#define AliOADBCache_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//     Process-wide cache of OADB containers
+//     Files are opened once per process, containers are indexed by run
+//     range and the objects are shared (read-only) between all the tasks
+//     of a train.
+//-------------------------------------------------------------------------
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <TObject.h>
+#include <TString.h>
+
+class TChain;
+class TCollection;
+class TFile;
+class AliOADBContainer;
+
+class AliOADBCache : public TObject {
+
+ public :
+  static AliOADBCache* Instance();
+  static void          Reset();
+  virtual ~AliOADBCache();
+
+  /// Container stored under key in the given file. The container is read
+  /// only the first time it is requested and is owned by the cache.
+  AliOADBContainer* GetContainer(const char* fileName, const char* key);
+
+  /// Object valid for run (or the default object def if no run range
+  /// matches). The returned object is shared with every other user of the
+  /// cache: it must not be modified nor deleted.
+  TObject* GetObject(const char* fileName, const char* key, Int_t run,
+                     const char* def = "", const char* passName = "");
+
+  /// Resolve the objects for all the runs in advance, so that run switches
+  /// during the event loop do not touch the file anymore.
+  Int_t    Prefetch(const char* fileName, const char* key, const std::vector<Int_t>& runs,
+                    const char* def = "", const char* passName = "");
+  Int_t    Prefetch(const char* fileName, const char* key, TChain* chain,
+                    const char* def = "", const char* passName = "");
+
+  static std::vector<Int_t> GetRunsFromFileList(TCollection* files);
+  static Int_t              GetRunFromPath(const char* path);
+
+  Int_t    GetNumberOfOpenFiles() const  { return fFiles.size(); }
+  Int_t    GetNumberOfContainers() const { return fContainers.size(); }
+  virtual void Print(Option_t* option = "") const;
+
+ private :
+  /// Run ranges of one container for one pass name, sorted by lower limit
+  struct RunIndex {
+    RunIndex() : fLower(), fUpper(), fEntry(), fOverlapping(kFALSE) {}
+    std::vector<Int_t> fLower;    ///< Lower run limits, ascending
+    std::vector<Int_t> fUpper;    ///< Upper run limits, same order as fLower
+    std::vector<Int_t> fEntry;    ///< Index of the object in the container
+    Bool_t             fOverlapping; ///< Ranges overlap (or pass specific): use the container linear search
+  };
+
+  struct Entry {
+    Entry() : fContainer(0x0), fIndices(), fResolved() {}
+    AliOADBContainer*                 fContainer; ///< Owned container
+    std::map<std::string, RunIndex>   fIndices;   ///< Run index per pass name
+    std::map<std::string, TObject*>   fResolved;  ///< Already resolved (run, default, pass) lookups
+  };
+
+  AliOADBCache();
+  AliOADBCache(const AliOADBCache& cache);            // not implemented
+  AliOADBCache& operator=(const AliOADBCache& cache); // not implemented
+
+  TFile*           GetFile(const char* fileName);
+  Entry*           GetEntry(const char* fileName, const char* key);
+  const RunIndex&  GetIndex(Entry& entry, const char* passName);
+  TObject*         Lookup(Entry& entry, Int_t run, const char* def, const char* passName);
+
+  static AliOADBCache* fgInstance;                 // singleton
+
+  std::map<std::string, TFile*> fFiles;            //! Opened OADB files, by expanded path
+  std::map<std::string, Entry>  fContainers;       //! Containers, by "file#key"
+
+  ClassDef(AliOADBCache, 0);
+};
+
+#endif
@@ -69,7 +69,8 @@ AliGenEMCocktailV2::AliGenEMCocktailV2():AliGenCocktail(),
   fCentrality(AliGenEMlibV2::kpp),
   fV2Systematic(AliGenEMlibV2::kNoV2Sys),
   fForceConv(kFALSE),
-  fSelectedParticles(kGenHadrons)
+  fSelectedParticles(kGenHadrons),
+  fPtTabulationPoints(0)
 {
   // Constructor
 }
@@ -141,6 +142,12 @@ void AliGenEMCocktailV2::CreateCocktail()
   SetMtScalingFactors();
   AliGenEMlibV2::SetPtParametrizations(fParametrizationFile, fParametrizationDir);
   SetPtParametrizations();
+  if (fPtTabulationPoints > 1) {
+    // the sources evaluate the pt parametrizations for every mother,
+    // interpolate in tables instead of evaluating the formulas
+    AliInfo(Form("tabulating the pt parametrizations with %d points",fPtTabulationPoints));
+    AliGenEMlibV2::TabulatePtParametrizations(fPtTabulationPoints);
+  }
   
   // Create and add electron sources to the generator
   // pizero
@@ -58,6 +58,7 @@ public:
   void    SetCentrality(AliGenEMlibV2::Centrality_t cent)             { fCentrality = cent;               }
   void    SetV2Systematic(AliGenEMlibV2::v2Sys_t v2sys)               { fV2Systematic = v2sys;            }
   void    SetForceGammaConversion(Bool_t force=kTRUE)                 { fForceConv=force;                 }
+  void    SetPtTabulation(Int_t nPoints=4000)                         { fPtTabulationPoints=nPoints;      }
   void    SetHeaviestHadron(ParticleGenerator_t part);
   static  Bool_t  SetPtParametrizations();
   static  void    SetMtScalingFactors();
@@ -71,6 +72,7 @@ public:
   TString GetParametrizationFile()          const                     { return fParametrizationFile;      }
   TString GetParametrizationFileDirectory() const                     { return fParametrizationDir;       }
   Int_t   GetNumberOfParticles()            const                     { return fNPart;                    }
+  Int_t   GetPtTabulation()                 const                     { return fPtTabulationPoints;       }
   void    GetPtRange(Double_t &ptMin, Double_t &ptMax);
   static TF1*   GetPtParametrization(Int_t np);
   static TH1D*  GetMtScalingFactors();
@@ -118,8 +120,9 @@ private:
   
   Bool_t        fForceConv;                             // select whether you want to force all gammas to convert imidediately
   UInt_t        fSelectedParticles;                     // which particles to simulate, allows to switch on and off 32 different particles
+  Int_t         fPtTabulationPoints;                    // number of points of the pt parametrization tables, 0: evaluate the TF1s
   
-  ClassDef(AliGenEMCocktailV2,5)       // cocktail for EM physics
+  ClassDef(AliGenEMCocktailV2,6)       // cocktail for EM physics
 };
 
 #endif
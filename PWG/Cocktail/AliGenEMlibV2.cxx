@@ -43,6 +43,9 @@ ClassImp(AliGenEMlibV2)
 TF1*  AliGenEMlibV2::fPtParametrization[]       = {0x0};
 TF1*  AliGenEMlibV2::fPtParametrizationProton   = NULL;
 TH1D* AliGenEMlibV2::fMtFactorHisto             = NULL;
+TArrayD  AliGenEMlibV2::fgPtTableValue[AliGenEMlibV2::kNParticles];
+Double_t AliGenEMlibV2::fgPtTableMin[]          = {0.};
+Double_t AliGenEMlibV2::fgPtTableStep[]         = {0.};
 Int_t AliGenEMlibV2::fgSelectedCollisionsSystem = AliGenEMlibV2::kpp7TeV;
 Int_t AliGenEMlibV2::fgSelectedCentrality       = AliGenEMlibV2::kpp;
 Int_t AliGenEMlibV2::fgSelectedV2Systematic     = AliGenEMlibV2::kNoV2Sys;
@@ -120,9 +123,9 @@ const Double_t AliGenEMlibV2::fgkThermPtParam[kCentralities][2] = {
 };
 
 // MASS   0=>PIZERO, 1=>ETA, 2=>RHO0, 3=>OMEGA, 4=>ETAPRIME, 5=>PHI, 6=>JPSI, 7=>SIGMA, 8=>K0s, 9=>DELTA++, 10=>DELTA+, 11=>DELTA-, 12=>DELTA0, 13=>Rho+, 14=>Rho-, 15=>K0*, 16=>K0l, 17=>Lambda
-const Double_t AliGenEMlibV2::fgkHM[18] = {0.1349766, 0.547853, 0.77549, 0.78265, 0.95778, 1.019455, 3.096916, 1.192642, 0.497614, 1.2311, 1.2349, 1.2349, 1.23340, 0.77549, 0.77549, 0.896, 0.497614, 1.115683};
+const Double_t AliGenEMlibV2::fgkHM[kNParticles] = {0.1349766, 0.547853, 0.77549, 0.78265, 0.95778, 1.019455, 3.096916, 1.192642, 0.497614, 1.2311, 1.2349, 1.2349, 1.23340, 0.77549, 0.77549, 0.896, 0.497614, 1.115683};
 
-const Double_t AliGenEMlibV2::fgkMtFactor[3][18] = {
+const Double_t AliGenEMlibV2::fgkMtFactor[3][kNParticles] = {
   // {1.0, 0.5, 1.0, 0.9, 0.4, 0.23, 0.054},  // factor for pp from arXiv:1110.3929
   // {1.0, 0.55, 1.0, 0.9, 0.4, 0.25, 0.004}    // factor for PbPb from arXiv:1110.3929
   //{1., 0.48, 1.0, 0.9, 0.25, 0.4}, (old values)
@@ -268,7 +271,7 @@ Int_t AliGenEMlibV2::IpPizero(TRandom *)
 Double_t AliGenEMlibV2::PtPizero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPizero]->Eval(pt);
+  return EvalPtParametrization(kPizero, pt);
 }
 
 Double_t AliGenEMlibV2::YPizero( const Double_t *py, const Double_t */*dummy*/ )
@@ -340,7 +343,7 @@ Int_t AliGenEMlibV2::IpEta(TRandom *)
 Double_t AliGenEMlibV2::PtEta( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEta]->Eval(pt);
+  return EvalPtParametrization(kEta, pt);
 }
 
 Double_t AliGenEMlibV2::YEta( const Double_t *py, const Double_t */*dummy*/ )
@@ -368,7 +371,7 @@ Int_t AliGenEMlibV2::IpRho0(TRandom *)
 Double_t AliGenEMlibV2::PtRho0( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRho0]->Eval(pt);
+  return EvalPtParametrization(kRho0, pt);
 }
 
 Double_t AliGenEMlibV2::YRho0( const Double_t *py, const Double_t */*dummy*/ )
@@ -396,7 +399,7 @@ Int_t AliGenEMlibV2::IpOmega(TRandom *)
 Double_t AliGenEMlibV2::PtOmega( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kOmega]->Eval(pt);
+  return EvalPtParametrization(kOmega, pt);
 }
 
 Double_t AliGenEMlibV2::YOmega( const Double_t *py, const Double_t */*dummy*/ )
@@ -425,7 +428,7 @@ Int_t AliGenEMlibV2::IpEtaprime(TRandom *)
 Double_t AliGenEMlibV2::PtEtaprime( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kEtaprime]->Eval(pt);
+  return EvalPtParametrization(kEtaprime, pt);
 }
 
 Double_t AliGenEMlibV2::YEtaprime( const Double_t *py, const Double_t */*dummy*/ )
@@ -454,7 +457,7 @@ Int_t AliGenEMlibV2::IpPhi(TRandom *)
 Double_t AliGenEMlibV2::PtPhi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kPhi]->Eval(pt);
+  return EvalPtParametrization(kPhi, pt);
 }
 
 Double_t AliGenEMlibV2::YPhi( const Double_t *py, const Double_t */*dummy*/ )
@@ -482,7 +485,7 @@ Int_t AliGenEMlibV2::IpJpsi(TRandom *)
 Double_t AliGenEMlibV2::PtJpsi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kJpsi]->Eval(pt);
+  return EvalPtParametrization(kJpsi, pt);
 }
 
 Double_t AliGenEMlibV2::YJpsi( const Double_t *py, const Double_t */*dummy*/ )
@@ -520,7 +523,7 @@ Int_t AliGenEMlibV2::IpSigma(TRandom *)
 Double_t AliGenEMlibV2::PtSigma( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kSigma0]->Eval(pt);
+  return EvalPtParametrization(kSigma0, pt);
 }
 
 Double_t AliGenEMlibV2::YSigma( const Double_t *py, const Double_t */*dummy*/ )
@@ -549,7 +552,7 @@ Int_t AliGenEMlibV2::IpK0short(TRandom *)
 Double_t AliGenEMlibV2::PtK0short( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0s]->Eval(pt);
+  return EvalPtParametrization(kK0s, pt);
 }
 
 Double_t AliGenEMlibV2::YK0short( const Double_t *py, const Double_t */*dummy*/ )
@@ -578,7 +581,7 @@ Int_t AliGenEMlibV2::IpK0long(TRandom *)
 Double_t AliGenEMlibV2::PtK0long( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0l]->Eval(pt);
+  return EvalPtParametrization(kK0l, pt);
 }
 
 Double_t AliGenEMlibV2::YK0long( const Double_t *py, const Double_t */*dummy*/ )
@@ -607,7 +610,7 @@ Int_t AliGenEMlibV2::IpLambda(TRandom *)
 Double_t AliGenEMlibV2::PtLambda( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kLambda]->Eval(pt);
+  return EvalPtParametrization(kLambda, pt);
 }
 
 Double_t AliGenEMlibV2::YLambda( const Double_t *py, const Double_t */*dummy*/ )
@@ -636,7 +639,7 @@ Int_t AliGenEMlibV2::IpDeltaPlPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPlPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPlPl]->Eval(pt);
+  return EvalPtParametrization(kDeltaPlPl, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPlPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -665,7 +668,7 @@ Int_t AliGenEMlibV2::IpDeltaPl(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaPl]->Eval(pt);
+  return EvalPtParametrization(kDeltaPl, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -694,7 +697,7 @@ Int_t AliGenEMlibV2::IpDeltaMi(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaMi]->Eval(pt);
+  return EvalPtParametrization(kDeltaMi, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -723,7 +726,7 @@ Int_t AliGenEMlibV2::IpDeltaZero(TRandom *)
 Double_t AliGenEMlibV2::PtDeltaZero( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kDeltaZero]->Eval(pt);
+  return EvalPtParametrization(kDeltaZero, pt);
 }
 
 Double_t AliGenEMlibV2::YDeltaZero( const Double_t *py, const Double_t */*dummy*/ )
@@ -752,7 +755,7 @@ Int_t AliGenEMlibV2::IpRhoPl(TRandom *)
 Double_t AliGenEMlibV2::PtRhoPl( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoPl]->Eval(pt);
+  return EvalPtParametrization(kRhoPl, pt);
 }
 
 Double_t AliGenEMlibV2::YRhoPl( const Double_t *py, const Double_t */*dummy*/ )
@@ -781,7 +784,7 @@ Int_t AliGenEMlibV2::IpRhoMi(TRandom *)
 Double_t AliGenEMlibV2::PtRhoMi( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kRhoMi]->Eval(pt);
+  return EvalPtParametrization(kRhoMi, pt);
 }
 
 Double_t AliGenEMlibV2::YRhoMi( const Double_t *py, const Double_t */*dummy*/ )
@@ -810,7 +813,7 @@ Int_t AliGenEMlibV2::IpK0star(TRandom *)
 Double_t AliGenEMlibV2::PtK0star( const Double_t *px, const Double_t */*dummy*/ )
 {
   const double &pt=px[0];
-  return fPtParametrization[kK0star]->Eval(pt);
+  return EvalPtParametrization(kK0star, pt);
 }
 
 Double_t AliGenEMlibV2::YK0star( const Double_t *py, const Double_t */*dummy*/ )
@@ -989,6 +992,9 @@ Double_t AliGenEMlibV2::GetTAA(Int_t cent){
 //--------------------------------------------------------------------------
 Bool_t AliGenEMlibV2::SetPtParametrizations(TString fileName, TString dirName) {
   
+  // tables of previous parametrizations are not valid anymore
+  ClearPtTabulation();
+
   // open parametrizations file
   TFile* fParametrizationFile = TFile::Open(fileName.Data());
   if (!fParametrizationFile) AliFatalClass(Form("File %s not found",fileName.Data()));
@@ -1015,7 +1021,7 @@ Bool_t AliGenEMlibV2::SetPtParametrizations(TString fileName, TString dirName) {
   TRandom* rndm;
 
   // get parametrizations from file
-  for (Int_t i=1; i<18; i++) {
+  for (Int_t i=1; i<kNParticles; i++) {
     Int_t ip = (Int_t)(lib.GetIp(i, ""))(rndm);
     fPtParametrizationTemp = (TF1*)fParametrizationDir->Get(Form("%d_pt", ip));
     if (fPtParametrizationTemp) {
@@ -1042,9 +1048,9 @@ Bool_t AliGenEMlibV2::SetPtParametrizations(TString fileName, TString dirName) {
 //
 //--------------------------------------------------------------------------
 TF1* AliGenEMlibV2::GetPtParametrization(Int_t np) {
-  if (np<18)
+  if (np<kNParticles)
     return fPtParametrization[np];
-  else if (np==18)
+  else if (np==kNParticles)
     return fPtParametrizationProton;
   else
     return NULL;
@@ -1137,6 +1143,69 @@ TH1D* AliGenEMlibV2::GetMtScalingFactors() {
 }
 
 
+//--------------------------------------------------------------------------
+//
+//                   tabulated pt parametrizations
+//
+//--------------------------------------------------------------------------
+Bool_t AliGenEMlibV2::TabulatePtParametrizations(Int_t nPoints) {
+
+  // Tabulate the pt parametrizations of all the sources on nPoints equidistant
+  // points over the range of the TF1. Afterwards the Pt* functions interpolate
+  // in the tables (log-linear for positive values) instead of evaluating the
+  // formula. Has to be called again whenever the parametrizations are changed.
+
+  ClearPtTabulation();
+  if (nPoints < 2) return kFALSE;
+
+  Double_t xmin, xmax;
+  for (Int_t np=0; np<kNParticles; np++) {
+    TF1* fct = fPtParametrization[np];
+    if (!fct) continue;
+    fct->GetRange(xmin, xmax);
+    if (xmax <= xmin) continue;
+
+    fgPtTableMin[np]  = xmin;
+    fgPtTableStep[np] = (xmax-xmin)/(nPoints-1);
+    fgPtTableValue[np].Set(nPoints);
+
+    Double_t* val = fgPtTableValue[np].GetArray();
+    for (Int_t i=0; i<nPoints; i++) {
+      val[i] = fct->Eval(xmin + i*fgPtTableStep[np]);
+      if (!(val[i] > 0.)) val[i] = 0.; // also catches NaN
+    }
+  }
+
+  return kTRUE;
+}
+
+//--------------------------------------------------------------------------
+void AliGenEMlibV2::ClearPtTabulation() {
+  for (Int_t np=0; np<kNParticles; np++) {
+    fgPtTableValue[np].Set(0);
+    fgPtTableMin[np]  = 0.;
+    fgPtTableStep[np] = 0.;
+  }
+}
+
+//--------------------------------------------------------------------------
+Double_t AliGenEMlibV2::EvalPtParametrization(Int_t np, Double_t pt) {
+
+  // value of the pt parametrization np, from the table if available
+  const Int_t n = fgPtTableValue[np].GetSize();
+  const Double_t x = n>1 ? (pt - fgPtTableMin[np])/fgPtTableStep[np] : -1.;
+  if (x < 0. || x > n-1) return fPtParametrization[np]->Eval(pt);
+
+  Int_t i = (Int_t)x;
+  if (i > n-2) i = n-2;
+  const Double_t f  = x - i;
+  const Double_t y0 = fgPtTableValue[np][i];
+  const Double_t y1 = fgPtTableValue[np][i+1];
+  if (y0 > 0. && y1 > 0.) return y0*TMath::Exp(f*TMath::Log(y1/y0));
+  return y0 + f*(y1-y0);
+}
+
+
 //==========================================================================
 //
 //                     Set Getters
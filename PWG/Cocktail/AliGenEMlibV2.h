@@ -19,6 +19,7 @@
 #include "TObject.h"
 #include "TF1.h"
 #include "TH1D.h"
+#include "TArrayD.h"
 
 class iostream;
 class TRandom;
@@ -34,6 +35,7 @@ public:
     kSigma0=7, kK0s=8, kDeltaPlPl=9, kDeltaPl=10, kDeltaMi=11, kDeltaZero=12,
     kRhoPl=13, kRhoMi=14, kK0star=15, kK0l=16, kLambda=17,
     kDirectRealGamma=18, kDirectVirtGamma=19};
+  enum { kNParticles=kLambda+1 };   // number of hadrons with a pt parametrization
   
   enum CollisionSystem_t {kpp900GeV=0x000, kpp2760GeV=0x64, kpp7TeV=0xC8, kpPb=0x12C, kPbPb=0x190};
   
@@ -63,6 +65,12 @@ public:
   static void   SetMtScalingFactors(TString fileName, TString dirName);
   static TF1*   GetPtParametrization(Int_t np);
   static TH1D*  GetMtScalingFactors();
+
+  // Tabulated pt parametrizations: interpolation instead of the TF1 evaluation
+  static Bool_t   TabulatePtParametrizations(Int_t nPoints=4000);
+  static void     ClearPtTabulation();
+  static Bool_t   IsPtTabulated(Int_t np)   { return np>=0 && np<kNParticles && fgPtTableValue[np].GetSize()>1; }
+  static Double_t EvalPtParametrization(Int_t np, Double_t pt);
   
   static Int_t fgSelectedCollisionsSystem;                                                      // selected pT parameter
   static Int_t fgSelectedCentrality;                                                            // selected Centrality
@@ -85,8 +93,8 @@ public:
   static const Double_t fgkV2param[kCentralities][16];                     // parameters of pi v2
   static const Double_t fgkRawPtOfV2Param[kCentralities][10];              // parameters of the raw pt spectrum of v2 analysys
   static const Double_t fgkThermPtParam[kCentralities][2];                 // parameters of thermal gamma pt
-  static const Double_t fgkHM[18];                                         // particle masses
-  static const Double_t fgkMtFactor[3][18];                                // mt scaling factor
+  static const Double_t fgkHM[kNParticles];                                       // particle masses
+  static const Double_t fgkMtFactor[3][kNParticles];                              // mt scaling factor
 
   // direct gamma
   static Double_t PtPromptRealGamma(const Double_t *px, const Double_t *dummy);
@@ -213,10 +221,14 @@ public:
   static Double_t V2K0star( const Double_t *px, const Double_t *dummy );
 
 private:
-  static TF1*     fPtParametrization[18];     // pt paramtrizations
+  static TF1*     fPtParametrization[kNParticles]; // pt paramtrizations
   static TF1*     fPtParametrizationProton;   // pt paramtrization
   static TH1D*    fMtFactorHisto;             // mt scaling factors
 
+  static TArrayD  fgPtTableValue[kNParticles];  // tabulated pt parametrizations
+  static Double_t fgPtTableMin[kNParticles];    // lower edge of the tables
+  static Double_t fgPtTableStep[kNParticles];   // pt step of the tables
+
   ClassDef(AliGenEMlibV2,5);
   
 };
@@ -58,6 +58,9 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fTriggerMask(AliVEvent::kAny),
   fZVertexCut(10),
   fMaxVertexDist(999),
+  fPreIndexEntries(kFALSE),
+  fTreeCacheSize(0),
+  fBranchesToRead(),
   fExternalFile(0),
   fCurrentEntry(0),
   fLowerEntry(0),
@@ -69,7 +72,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fInitializedNewFile(false),
   fWrappedAroundTree(false),
   fChain(0),
-  fExternalEvent(0)
+  fExternalEvent(0),
+  fEntryIndex()
 {
   if (fgInstance != 0) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -98,6 +102,9 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fTriggerMask(AliVEvent::kAny),
   fZVertexCut(10),
   fMaxVertexDist(999),
+  fPreIndexEntries(kFALSE),
+  fTreeCacheSize(0),
+  fBranchesToRead(),
   fExternalFile(0),
   fCurrentEntry(0),
   fLowerEntry(0),
@@ -109,7 +116,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fInitializedNewFile(false),
   fWrappedAroundTree(false),
   fChain(0),
-  fExternalEvent(0)
+  fExternalEvent(0),
+  fEntryIndex()
 {
   if (fgInstance != 0) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -296,6 +304,7 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::GenerateUniqueFileListFilename(
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 {
   Int_t attempts = -1;
+  Bool_t rejectedByIndex = kFALSE;
 
   do {
     // Reset to start of tree
@@ -318,12 +327,8 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       InitTree();
     }
 
-    // Load current event
     // Can be a simple less than, because fFileNumber counts from 0.
-    if (fFileNumber < fMaxNumberOfFiles) {
-      fChain->GetEntry(fCurrentEntry);
-    }
-    else {
+    if (fFileNumber >= fMaxNumberOfFiles) {
       AliError("====================================================================================================");
       AliError("== No more files available to embed from the TChain! Restarting from the beginning of the TChain! ==");
       AliError("== Be careful to check that this is the desired action!                                           ==");
@@ -335,23 +340,28 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
       fUpperEntry = 0;
 
       // Re-init back to the start
+      // We are certain that fFileNumber is less than fMaxNumberOfFiles, so we are resetting to start
       InitTree();
+    }
 
-      // Access the relevant entry
-      // We are certain that fFileNumber is less than fMaxNumberOfFiles, so we are resetting to start
-      fChain->GetEntry(fCurrentEntry);
+    // Provide a check for number of attempts (the entries rejected by the entry index count as well)
+    attempts++;
+    if (attempts == 1000)
+      AliWarning("After 1000 attempts no event has been accepted by the event selection (trigger, centrality...)!");
+
+    // Load current event, unless the entry index tells that it fails the vertex selection
+    rejectedByIndex = !IsEntryPreselected(fCurrentEntry);
+    if (rejectedByIndex) {
+      fCurrentEntry++;
+      continue;
     }
+    fChain->GetEntry(fCurrentEntry);
     AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", fCurrentEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
 
     // Increment current entry
     fCurrentEntry++;
-    
-    // Provide a check for number of attempts
-    attempts++;
-    if (attempts == 1000)
-      AliWarning("After 1000 attempts no event has been accepted by the event selection (trigger, centrality...)!");
 
-  } while (!IsEventSelected());
+  } while (rejectedByIndex || !IsEventSelected());
 
   if (!fChain) return kFALSE;
 
@@ -541,6 +551,115 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::SetupInputFiles()
   Bool_t res = InitEvent();
   if (!res) return kFALSE;
 
+  SetActiveBranches();
+  if (fTreeCacheSize > 0) {
+    fChain->SetCacheSize(fTreeCacheSize);
+  }
+
+  return kTRUE;
+}
+
+/**
+ * Activate only the branches requested with AddBranchToRead(), or all branches if none was requested.
+ * The TTreeCache (if any) then only reads ahead the baskets of these branches.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::SetActiveBranches()
+{
+  if (fBranchesToRead.empty()) {
+    fChain->SetBranchStatus("*", 1);
+    return;
+  }
+
+  fChain->SetBranchStatus("*", 0);
+  for (auto branchName : fBranchesToRead) {
+    fChain->SetBranchStatus(branchName.c_str(), 1);
+  }
+}
+
+/**
+ * Reads only the vertex branches of all the entries of the current tree and stores the vertex positions,
+ * such that the entries failing the vertex selection in IsEventSelected() are skipped without reading
+ * the full event. The active branches are restored afterwards.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::BuildEntryIndex()
+{
+  fEntryIndex.clear();
+  // Nothing to index past the last file (embedding restarts from the first file)
+  if (!fPreIndexEntries || fFileNumber >= fMaxNumberOfFiles) return;
+
+  fChain->SetBranchStatus("*", 0);
+  if (fTreeName == "esdTree") {
+    fChain->SetBranchStatus("*Vertex*", 1);
+  }
+  else {
+    fChain->SetBranchStatus("vertices*", 1);
+  }
+
+  Int_t nEntries = fUpperEntry - fLowerEntry;
+  fEntryIndex.resize(nEntries);
+  Int_t nWithVertex = 0;
+  Double_t vertex[3] = {0};
+  for (Int_t i = 0; i < nEntries; i++) {
+    fChain->GetEntry(fLowerEntry + i);
+    const AliVVertex *vert = fExternalEvent->GetPrimaryVertex();
+    EntryInfo & info = fEntryIndex[i];
+    info.fHasVertex = (vert != 0);
+    if (vert) {
+      vert->GetXYZ(vertex);
+      nWithVertex++;
+    }
+    for (Int_t j = 0; j < 3; j++) {
+      info.fVertex[j] = vert ? vertex[j] : 0;
+    }
+  }
+
+  SetActiveBranches();
+  // The cache learnt only the vertex branches while indexing: add the branches read by the analysis
+  if (fTreeCacheSize > 0) {
+    if (fBranchesToRead.empty()) {
+      fChain->AddBranchToCache("*", kTRUE);
+    }
+    else {
+      for (auto branchName : fBranchesToRead) {
+        fChain->AddBranchToCache(branchName.c_str(), kTRUE);
+      }
+    }
+  }
+
+  Int_t nSelected = 0;
+  for (Int_t i = 0; i < nEntries; i++) {
+    if (!fEntryIndex[i].fHasVertex || TMath::Abs(fEntryIndex[i].fVertex[2]) <= fZVertexCut) nSelected++;
+  }
+  AliDebug(2, TString::Format("Indexed %i entries, %i with vertex, %i within the z vertex cut", nEntries, nWithVertex, nSelected));
+  if (nSelected == 0) {
+    AliWarning(TString::Format("No entry of file %i passes the z vertex selection!", fFileNumber));
+  }
+}
+
+/**
+ * Applies the vertex selection of IsEventSelected() to the indexed vertex of the entry.
+ *
+ * @param[in] entry Entry in the TChain
+ * @return kFALSE if the entry is known to fail the vertex selection
+ */
+Bool_t AliAnalysisTaskEmcalEmbeddingHelper::IsEntryPreselected(Int_t entry) const
+{
+  Int_t i = entry - fLowerEntry;
+  if (i < 0 || i >= static_cast<Int_t>(fEntryIndex.size())) return kTRUE;
+  const EntryInfo & info = fEntryIndex[i];
+  const AliVVertex *inputVert = InputEvent()->GetPrimaryVertex();
+  if (!info.fHasVertex || !inputVert) return kTRUE;
+
+  if (TMath::Abs(info.fVertex[2]) > fZVertexCut) return kFALSE;
+
+  Double_t inputVertex[3] = {0};
+  inputVert->GetXYZ(inputVertex);
+  Double_t dist2 = 0;
+  for (Int_t j = 0; j < 3; j++) {
+    dist2 += (info.fVertex[j] - inputVertex[j])*(info.fVertex[j] - inputVertex[j]);
+  }
+  if (TMath::Sqrt(dist2) > fMaxVertexDist) return kFALSE; // same comparison as IsEventSelected()
+
   return kTRUE;
 }
 
@@ -616,6 +735,9 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
   // (re)set whether we have wrapped the tree
   fWrappedAroundTree = false;
 
+  // Index the vertices of the new tree if requested
+  BuildEntryIndex();
+
   // Note that the tree in the new file has been initialized
   fInitializedNewFile = kTRUE;
 }
@@ -98,6 +98,17 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetZVertexCut(Double_t zVertex)                            { fZVertexCut = zVertex; }
   void SetMaxVertexDistance(Double_t distance)                    { fMaxVertexDist = distance; }
 
+  Bool_t GetPreIndexEntries()                               const { return fPreIndexEntries; }
+  Long64_t GetTreeCacheSize()                               const { return fTreeCacheSize; }
+  const std::vector<std::string>& GetBranchesToRead()       const { return fBranchesToRead; }
+
+  /// Read the vertices of all the entries of a new tree first, so that only the entries passing the vertex selection are fully read
+  void SetPreIndexEntries(Bool_t b = kTRUE)                       { fPreIndexEntries = b; }
+  /// Size of the TTreeCache of the embedding chain (read ahead of the baskets of the active branches)
+  void SetTreeCacheSize(Long64_t size)                            { fTreeCacheSize = size; }
+  /// Only read the given branches (wildcards allowed) of the embedded events. All the branches are read if none is given.
+  void AddBranchToRead(const char * branchName)                   { fBranchesToRead.push_back(branchName); }
+
   static AliAnalysisTaskEmcalEmbeddingHelper * AddTaskEmcalEmbeddingHelper();
 
  protected:
@@ -109,10 +120,22 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t          IsEventSelected()     ;
   Bool_t          InitEvent()           ;
   void            InitTree()            ;
+  void            SetActiveBranches()   ;
+  void            BuildEntryIndex()     ;
+  Bool_t          IsEntryPreselected(Int_t entry) const;
+
+  /// Vertex of one entry of the current tree, filled by BuildEntryIndex()
+  struct EntryInfo {
+    Double_t fVertex[3];  ///< Primary vertex position
+    Bool_t  fHasVertex;   ///< A primary vertex is available
+  };
 
   UInt_t                                        fTriggerMask;       ///<  Trigger selection mask
   Double_t                                      fZVertexCut;        ///<  Z vertex cut on embedded event
   Double_t                                      fMaxVertexDist;     ///<  Max distance between Z vertex of internal and embedded event
+  Bool_t                                        fPreIndexEntries;   ///<  Pre-read the vertices of each tree to skip the entries failing the vertex selection
+  Long64_t                                      fTreeCacheSize;     ///<  Size of the TTreeCache of the embedding chain (0: ROOT default)
+  std::vector <std::string>                     fBranchesToRead;    ///<  Branches of the embedded events to be read (all if empty)
 
   bool                                          fInitializedNewFile; //!<! Notes where the entry indices have been initialized for a new tree in the chain
   bool                                          fInitializedEmbedding; //!<! Notes where the TChain has been initialized for embedding
@@ -137,6 +160,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t                                         fMaxNumberOfFiles ; //!<! Max number of files that are in the TChain
   Int_t                                         fFileNumber       ; //!<! File number corresponding to the current tree
   AliVEvent                                    *fExternalEvent    ; //!<! Current external event available for embedding
+  std::vector <EntryInfo>                       fEntryIndex       ; //!<! Vertices of the entries of the current tree (if fPreIndexEntries)
 
   static AliAnalysisTaskEmcalEmbeddingHelper   *fgInstance        ; //!<! Global instance of this class
 
@@ -145,7 +169,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 1);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 2);
   /// \endcond
 };
 #endif
@@ -45,6 +45,7 @@
 #include "AliFlowVector.h"
 #include "AliFlowTrackSimple.h"
 #include "AliFlowAnalysisCRC.h"
+#include "AliFlowProfileStore.h"
 #include "AliLog.h"
 #include "TRandom.h"
 #include "TF1.h"
@@ -264,6 +265,7 @@ fCalculateCRC2(kFALSE),
 fCalculateCRCVZ(kFALSE),
 fCalculateCRCZDC(kFALSE),
 fCalculateFlowQC(kFALSE),
+fUseCompactProfiles(kFALSE),
 fCalculateFlowZDC(kFALSE),
 fCalculateFlowVZ(kFALSE),
 fCalculateEbEFlow(kFALSE),
@@ -313,6 +315,7 @@ fCRC2nEtaBins(6),
 fCRC2RbRList(NULL),
 fFlowSPZDCList(NULL),
 fFlowQCList(NULL),
+fFlowQCProfileStore(NULL),
 //fFlowQCOrdMagList(NULL),
 fFlowQCHOList(NULL),
 fFlowQCCenBin(100),
@@ -709,20 +712,38 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
   
   // loop over particles **********************************************************************************************
   
+  // the track arrays are filled once per event by the producer, read the tracks only if they are not there
+  Bool_t bUseArrays = anEvent->HasTrackArrays();
+  Bool_t bRP = kFALSE, bPOI = kFALSE;
   for(Int_t i=0;i<nPrim;i++) {
     if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
-    aftsTrack=anEvent->GetTrack(i);
-    if(aftsTrack) {
-      if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())){continue;} // safety measure: consider only tracks which are RPs or POIs
+    if(bUseArrays) {
+      bRP = anEvent->GetArrayInRPSelection(i);
+      bPOI = anEvent->GetArrayInPOISelection(i);
+      dPhi = anEvent->GetArrayPhi(i);
+      dPt  = anEvent->GetArrayPt(i);
+      dEta = anEvent->GetArrayEta(i);
+      dCharge = anEvent->GetArrayCharge(i);
+    } else {
+      aftsTrack=anEvent->GetTrack(i);
+      if(!aftsTrack) {
+        printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
+        continue;
+      }
+      bRP = aftsTrack->InRPSelection();
+      bPOI = aftsTrack->InPOISelection();
+      dPhi = aftsTrack->Phi();
+      dPt  = aftsTrack->Pt();
+      dEta = aftsTrack->Eta();
+      dCharge = aftsTrack->Charge();
+    }
+    {
+      if(!(bRP || bPOI)){continue;} // safety measure: consider only tracks which are RPs or POIs
       
       // RPs *********************************************************************************************************
       
-      if(aftsTrack->InRPSelection()) {
+      if(bRP) {
         nCounterNoRPs++;
-        dPhi = aftsTrack->Phi();
-        dPt  = aftsTrack->Pt();
-        dEta = aftsTrack->Eta();
-        dCharge = aftsTrack->Charge();
         
         if(fSelectCharge==kPosCh && dCharge<0.) continue;
         if(fSelectCharge==kNegCh && dCharge>0.) continue;
@@ -825,7 +846,7 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
             } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
           } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
           // Checking if RP particle is also POI particle:
-          if(aftsTrack->InPOISelection())
+          if(bPOI)
           {
             // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs):
             for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
@@ -855,7 +876,7 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
                 } // end of if(fCalculate2DDiffFlow)
               } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
             } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
-          } // end of if(aftsTrack->InPOISelection())
+          } // end of if(bPOI)
         } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)
         
 //        for (Int_t k=0; k<fQVecPower; k++) {
@@ -881,16 +902,11 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
 //          }
 //        }
         
-      } // end of if(pTrack->InRPSelection())
+      } // end of if(bRP)
       
       // POIs ********************************************************************************************************
       
-      if(aftsTrack->InPOISelection()) {
-        dPhi = aftsTrack->Phi();
-        dPt  = aftsTrack->Pt();
-        dEta = aftsTrack->Eta();
-        dCharge = aftsTrack->Charge();
-        
+      if(bPOI) {
         if(fSelectCharge==kPosCh && dCharge<0.) continue;
         if(fSelectCharge==kNegCh && dCharge>0.) continue;
         
@@ -1119,10 +1135,7 @@ void AliFlowAnalysisCRC::Make(AliFlowEventSimple* anEvent)
         fFlowQCSpectraPubBin->Fill(fCentralityEBE,dPt,wPhiEta*fCenWeightEbE);
         fFlowQCSpectraCharge[cw]->Fill(fCentralityEBE,dPt,wPhiEta*fCenWeightEbE);
         
-      } // end of if(pTrack->InPOISelection())
-    } else // to if(aftsTrack)
-    {
-      printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
+      } // end of if(bPOI)
     }
   } // end of for(Int_t i=0;i<nPrim;i++)
   
@@ -20901,18 +20914,18 @@ void AliFlowAnalysisCRC::CalculateFlowQC()
       WdQM2 = (WeigMul? dQM2 : 1.);
       if(qpM0>0 && QM0>1) {
         dQC2 = (qpRe0*QRe+qpIm0*QIm-qpM)/dQM2;
-        fFlowQCCorPro[fCenBin][hr][1]->Fill(FillPtBin,dQC2,WdQM2*fCenWeightEbE);
+        FillFlowQCCorPro(hr,1,FillPtBin,dQC2,WdQM2*fCenWeightEbE);
         fFlowQCIntCorProTest[hr][3]->Fill(fCentralityEBE,FillPtBin,dQC2,WdQM2*fCenWeightEbE);
         // NUA
         WqpM0 = (WeigMul? qpM0 : 1.);
         sinP1 = qpIm0/qpM0;
         cosP1 = qpRe0/qpM0;
-        fFlowQCCorNUAPro[fCenBin][hr][0]->Fill(FillPtBin,sinP1,WqpM0*fCenWeightEbE); // <<sin n(psi1)>>
-        fFlowQCCorNUAPro[fCenBin][hr][1]->Fill(FillPtBin,cosP1,WqpM0*fCenWeightEbE); // <<cos n(psi1)>>
+        FillFlowQCCorNUAPro(hr,0,FillPtBin,sinP1,WqpM0*fCenWeightEbE); // <<sin n(psi1)>>
+        FillFlowQCCorNUAPro(hr,1,FillPtBin,cosP1,WqpM0*fCenWeightEbE); // <<cos n(psi1)>>
         sinP1W1 = (qpRe0*QIm+qpIm0*QRe-qp2Im)/dQM2;
         cosP1W1 = (qpRe0*QIm+qpIm0*QRe-qp2Im)/dQM2;
-        fFlowQCCorNUAPro[fCenBin][hr][2]->Fill(FillPtBin,sinP1W1,WdQM2*fCenWeightEbE); //sin(n*(psi1+phi2))
-        fFlowQCCorNUAPro[fCenBin][hr][3]->Fill(FillPtBin,cosP1W1,WdQM2*fCenWeightEbE); //cos(n*(psi1+phi2))
+        FillFlowQCCorNUAPro(hr,2,FillPtBin,sinP1W1,WdQM2*fCenWeightEbE); //sin(n*(psi1+phi2))
+        FillFlowQCCorNUAPro(hr,3,FillPtBin,cosP1W1,WdQM2*fCenWeightEbE); //cos(n*(psi1+phi2))
         dQ2f = kTRUE;
       }
       
@@ -20931,7 +20944,7 @@ void AliFlowAnalysisCRC::CalculateFlowQC()
                          + 2.*(qpRe0*QRe3+qpIm0*QIm3)
                          + 2.*qpM*QM2
                          - 6.*qpM3) / dQM4;
-        fFlowQCCorPro[fCenBin][hr][2]->Fill(FillPtBin,dQC4,WdQM4*fCenWeightEbE);
+        FillFlowQCCorPro(hr,2,FillPtBin,dQC4,WdQM4*fCenWeightEbE);
         fFlowQCIntCorProTest[hr][4]->Fill(fCentralityEBE,FillPtBin,dQC4,WdQM4*fCenWeightEbE);
         
         // NUA
@@ -20942,36 +20955,36 @@ void AliFlowAnalysisCRC::CalculateFlowQC()
                                                + qp2Re*QIm - qp2Im*QRe
                                                - qpM*QIm
                                                + 2.*qpIm2) / dM11;
-        fFlowQCCorNUAPro[fCenBin][hr][4]->Fill(FillPtBin,sinP1W1,WM11*fCenWeightEbE);  //sin(n(psi1+phi2-phi3))
+        FillFlowQCCorNUAPro(hr,4,FillPtBin,sinP1W1,WM11*fCenWeightEbE);  //sin(n(psi1+phi2-phi3))
         
         cosP1W1 = (qpRe0*(pow(QIm,2.)+pow(QRe,2.))
                                                - qpRe0*QM2
                                                - qp2Re*QRe - qp2Im*QIm
                                                - qpM*QRe
                                                + 2.*qpRe2) / dM11;
-        fFlowQCCorNUAPro[fCenBin][hr][5]->Fill(FillPtBin,cosP1W1,WM11*fCenWeightEbE); //cos(n(psi1+phi2-phi3))
+        FillFlowQCCorNUAPro(hr,5,FillPtBin,cosP1W1,WM11*fCenWeightEbE); //cos(n(psi1+phi2-phi3))
         
         sinP1W1 = (qpIm0*(pow(QRe,2.)-pow(QIm,2.))-2.*qpRe0*QRe*QIm
                                                + 1.*(qpRe0*Q2Im2-qpIm0*Q2Re2)
                                                + 2.*qpM*QIm
                                                - 2.*qpIm2) / dM11;
-        fFlowQCCorNUAPro[fCenBin][hr][6]->Fill(FillPtBin,sinP1W1,WM11*fCenWeightEbE);  //sin(n(psi1-phi2-phi3))
+        FillFlowQCCorNUAPro(hr,6,FillPtBin,sinP1W1,WM11*fCenWeightEbE);  //sin(n(psi1-phi2-phi3))
         
         cosP1W1 = (qpRe0*(pow(QRe,2.)-pow(QIm,2.))+2.*qpIm0*QRe*QIm
                                                - 1.*(qpRe0*Q2Re2+qpIm0*Q2Im2)
                                                - 2.*qpM*QRe
                                                + 2.*qpRe2) / dM11;
-        fFlowQCCorNUAPro[fCenBin][hr][7]->Fill(FillPtBin,cosP1W1,WM11*fCenWeightEbE); //cos(n(psi1-phi2-phi3))
+        FillFlowQCCorNUAPro(hr,7,FillPtBin,cosP1W1,WM11*fCenWeightEbE); //cos(n(psi1-phi2-phi3))
         
         dQ4f = kTRUE;
       }
       
       // product of correlations or covariances
-      if(Q2f && dQ2f) fFlowQCCorCovPro[fCenBin][hr][0]->Fill(FillPtBin,IQC2[hr]*dQC2,WQM2*WdQM2*fCenWeightEbE);
-      if(Q4f && dQ2f) fFlowQCCorCovPro[fCenBin][hr][1]->Fill(FillPtBin,IQC4[hr]*dQC2,WQM4*WdQM2*fCenWeightEbE);
-      if(Q2f && dQ4f) fFlowQCCorCovPro[fCenBin][hr][2]->Fill(FillPtBin,IQC2[hr]*dQC4,WQM2*WdQM4*fCenWeightEbE);
-      if(dQ2f && dQ4f) fFlowQCCorCovPro[fCenBin][hr][3]->Fill(FillPtBin,dQC2*dQC4,WdQM2*WdQM4*fCenWeightEbE);
-      if(Q4f && dQ4f) fFlowQCCorCovPro[fCenBin][hr][4]->Fill(FillPtBin,IQC4[hr]*dQC4,WQM4*WdQM4*fCenWeightEbE);
+      if(Q2f && dQ2f) FillFlowQCCorCovPro(hr,0,FillPtBin,IQC2[hr]*dQC2,WQM2*WdQM2*fCenWeightEbE);
+      if(Q4f && dQ2f) FillFlowQCCorCovPro(hr,1,FillPtBin,IQC4[hr]*dQC2,WQM4*WdQM2*fCenWeightEbE);
+      if(Q2f && dQ4f) FillFlowQCCorCovPro(hr,2,FillPtBin,IQC2[hr]*dQC4,WQM2*WdQM4*fCenWeightEbE);
+      if(dQ2f && dQ4f) FillFlowQCCorCovPro(hr,3,FillPtBin,dQC2*dQC4,WdQM2*WdQM4*fCenWeightEbE);
+      if(Q4f && dQ4f) FillFlowQCCorCovPro(hr,4,FillPtBin,IQC4[hr]*dQC4,WQM4*WdQM4*fCenWeightEbE);
       
       // eta-gap
       qpARe = fPOIPtDiffQReEG[0][1][hr+1]->GetBinContent(pt+1);
@@ -20988,7 +21001,7 @@ void AliFlowAnalysisCRC::CalculateFlowQC()
       WdQM2EG = (WeigMul? dQM2EG : 1.);
       if(qpAM0>0 && QBM0>0) {
         dQC2EG = (qpARe*QBRe+qpAIm*QBIm)/dQM2EG;
-        fFlowQCCorPro[fCenBin][hr][3]->Fill(FillPtBin,dQC2EG,WdQM2EG*fCenWeightEbE);
+        FillFlowQCCorPro(hr,3,FillPtBin,dQC2EG,WdQM2EG*fCenWeightEbE);
         fFlowQCIntCorProTest[hr][5]->Fill(fCentralityEBE,FillPtBin,dQC2EG,WdQM2EG*fCenWeightEbE);
         dQ2EGf = kTRUE;
       }
@@ -20997,18 +21010,18 @@ void AliFlowAnalysisCRC::CalculateFlowQC()
       if(qpAM0>0) {
         cosP1 = qpARe/qpAM;
         sinP1 = qpAIm/qpAM;
-        fFlowQCCorNUAPro[fCenBin][hr][8]->Fill(FillPtBin,cosP1,WqpAM*fCenWeightEbE);
-        fFlowQCCorNUAPro[fCenBin][hr][9]->Fill(FillPtBin,sinP1,WqpAM*fCenWeightEbE);
+        FillFlowQCCorNUAPro(hr,8,FillPtBin,cosP1,WqpAM*fCenWeightEbE);
+        FillFlowQCCorNUAPro(hr,9,FillPtBin,sinP1,WqpAM*fCenWeightEbE);
       }
       // product of correlations or covariances
-      if(Q2EGf && dQ2EGf) fFlowQCCorCovPro[fCenBin][hr][5]->Fill(FillPtBin,IQC2EG[hr]*dQC2EG,WQM2EG*WdQM2EG*fCenWeightEbE);
+      if(Q2EGf && dQ2EGf) FillFlowQCCorCovPro(hr,5,FillPtBin,IQC2EG[hr]*dQC2EG,WQM2EG*WdQM2EG*fCenWeightEbE);
       
       // qB QA (reversed)
       dQM2EGB = qpBM*QAM;
       WdQM2EGB = (WeigMul? dQM2EGB : 1.);
       if(qpBM0>0 && QAM0>0) {
         dQC2EGB = (qpBRe*QARe+qpBIm*QAIm)/dQM2EGB;
-        fFlowQCCorPro[fCenBin][hr][0]->Fill(FillPtBin,dQC2EGB,WdQM2EGB*fCenWeightEbE);
+        FillFlowQCCorPro(hr,0,FillPtBin,dQC2EGB,WdQM2EGB*fCenWeightEbE);
         dQ2EGf = kTRUE;
       }
       // NUA
@@ -21016,14 +21029,14 @@ void AliFlowAnalysisCRC::CalculateFlowQC()
       if(qpBM0>0) {
         cosP1 = qpBRe/qpBM;
         sinP1 = qpBIm/qpBM;
-        fFlowQCCorNUAPro[fCenBin][hr][10]->Fill(FillPtBin,cosP1,WqpAM*fCenWeightEbE);
-        fFlowQCCorNUAPro[fCenBin][hr][11]->Fill(FillPtBin,sinP1,WqpAM*fCenWeightEbE);
+        FillFlowQCCorNUAPro(hr,10,FillPtBin,cosP1,WqpAM*fCenWeightEbE);
+        FillFlowQCCorNUAPro(hr,11,FillPtBin,sinP1,WqpAM*fCenWeightEbE);
       }
       // product of correlations or covariances
-      if(Q2EGf && dQ2EGf) fFlowQCCorCovPro[fCenBin][hr][6]->Fill(FillPtBin,IQC2EG[hr]*dQC2EGB,WQM2EG*WdQM2EGB*fCenWeightEbE);
+      if(Q2EGf && dQ2EGf) FillFlowQCCorCovPro(hr,6,FillPtBin,IQC2EG[hr]*dQC2EGB,WQM2EG*WdQM2EGB*fCenWeightEbE);
       
       if(qpBM0>0 && QAM0>0 && qpAM0>0 && QBM0>0) {
-        fFlowQCCorCovPro[fCenBin][hr][7]->Fill(FillPtBin,dQC2EG*dQC2EGB,WdQM2EG*WdQM2EGB*fCenWeightEbE);
+        FillFlowQCCorCovPro(hr,7,FillPtBin,dQC2EG*dQC2EGB,WdQM2EG*WdQM2EGB*fCenWeightEbE);
       }
       
     } // end of for(Int_t pt=0; pt<fCRCnPtBin; pt++)
@@ -21164,6 +21177,30 @@ void AliFlowAnalysisCRC::CalculateFlowQC()
 
 //=======================================================================================================================
 
+void AliFlowAnalysisCRC::FillFlowQCCorPro(Int_t const eg, Int_t const k, Double_t const x, Double_t const y, Double_t const w)
+{
+  if(fFlowQCProfileStore) fFlowQCProfileStore->Fill(GetFlowQCProfileId(fCenBin,eg,k),x,y,w);
+  else fFlowQCCorPro[fCenBin][eg][k]->Fill(x,y,w);
+}
+
+//=======================================================================================================================
+
+void AliFlowAnalysisCRC::FillFlowQCCorNUAPro(Int_t const eg, Int_t const k, Double_t const x, Double_t const y, Double_t const w)
+{
+  if(fFlowQCProfileStore) fFlowQCProfileStore->Fill(GetFlowQCProfileId(fCenBin,eg,fFlowQCNPro+k),x,y,w);
+  else fFlowQCCorNUAPro[fCenBin][eg][k]->Fill(x,y,w);
+}
+
+//=======================================================================================================================
+
+void AliFlowAnalysisCRC::FillFlowQCCorCovPro(Int_t const eg, Int_t const k, Double_t const x, Double_t const y, Double_t const w)
+{
+  if(fFlowQCProfileStore) fFlowQCProfileStore->Fill(GetFlowQCProfileId(fCenBin,eg,fFlowQCNPro+fFlowQCNNUA+k),x,y,w);
+  else fFlowQCCorCovPro[fCenBin][eg][k]->Fill(x,y,w);
+}
+
+//=======================================================================================================================
+
 void AliFlowAnalysisCRC::CalculateFlowQCHighOrders()
 {
   for(Int_t hr=0; hr<fFlowNHarmHighOrd; hr++) {
@@ -23915,6 +23952,9 @@ void AliFlowAnalysisCRC::FinalizeFlowSPZDC()
 
 void AliFlowAnalysisCRC::FinalizeFlowQC()
 {
+  // in compact mode the profiles are made from fFlowQCProfileStore
+  if(fFlowQCProfileStore && !fFlowQCCorPro[0][0][0]) this->GetPointersForFlowQC();
+  
   cout << "*************************************" << endl;
   cout << endl;
   cout << "calculating v_n{QC,4}"; if(fNUAforCRC) { cout << " (corrected for NUA)";}
@@ -27911,6 +27951,10 @@ void AliFlowAnalysisCRC::GetPointersForFlowQC()
     exit(0);
   }
   
+  // differential profiles filled in compact mode
+  AliFlowProfileStore *FlowQCProfileStore = dynamic_cast<AliFlowProfileStore*>(fFlowQCList->FindObject("fFlowQCProfileStore"));
+  if(FlowQCProfileStore) { FlowQCProfileStore->MakeProfiles(fFlowQCList); }
+  
   for (Int_t h=0; h<fCRCnCen; h++) {
     for(Int_t i=0; i<fFlowNHarm; i++) {
       for(Int_t j=0; j<fFlowQCNPro; j++) {
@@ -29725,12 +29769,22 @@ void AliFlowAnalysisCRC::BookEverythingForFlowQC()
     }
   }
   // differential flow
+  // in compact mode the profiles are booked in fFlowQCProfileStore, in the order of GetFlowQCProfileId(),
+  // and made into TProfiles when the output is read (GetPointersForFlowQC)
+  if(fUseCompactProfiles) {
+    fFlowQCProfileStore = new AliFlowProfileStore("fFlowQCProfileStore","differential flow QC profiles");
+    fFlowQCList->Add(fFlowQCProfileStore);
+  }
   for (Int_t h=0; h<fCRCnCen; h++) {
     for(Int_t i=0; i<fFlowNHarm; i++) {
       for(Int_t j=0; j<fFlowQCNPro; j++) {
-        fFlowQCCorPro[h][i][j] = new TProfile(Form("fFlowQCCorPro[%d][%d][%d]",h,i,j),Form("fFlowQCCorPro[%d][%d][%d]",h,i,j),fPtDiffNBins,fCRCPtBins,"s");
-        fFlowQCCorPro[h][i][j]->Sumw2();
-        fFlowQCList->Add(fFlowQCCorPro[h][i][j]);
+        if(fFlowQCProfileStore) {
+          fFlowQCProfileStore->Book(Form("fFlowQCCorPro[%d][%d][%d]",h,i,j),Form("fFlowQCCorPro[%d][%d][%d]",h,i,j),fPtDiffNBins,fCRCPtBins,"s");
+        } else {
+          fFlowQCCorPro[h][i][j] = new TProfile(Form("fFlowQCCorPro[%d][%d][%d]",h,i,j),Form("fFlowQCCorPro[%d][%d][%d]",h,i,j),fPtDiffNBins,fCRCPtBins,"s");
+          fFlowQCCorPro[h][i][j]->Sumw2();
+          fFlowQCList->Add(fFlowQCCorPro[h][i][j]);
+        }
         fFlowQCCorHist[h][i][j] = new TH1D(Form("fFlowQCCorHist[%d][%d][%d]",h,i,j),Form("fFlowQCCorHist[%d][%d][%d]",h,i,j),fPtDiffNBins,fCRCPtBins);
         fFlowQCCorHist[h][i][j]->Sumw2();
         fFlowQCList->Add(fFlowQCCorHist[h][i][j]);
@@ -29739,17 +29793,25 @@ void AliFlowAnalysisCRC::BookEverythingForFlowQC()
         fFlowQCList->Add(fFlowQCCorProPhi[h][i][j]);
       }
       for(Int_t k=0; k<fFlowQCNNUA; k++) {
-        fFlowQCCorNUAPro[h][i][k] = new TProfile(Form("fFlowQCCorNUAPro[%d][%d][%d]",h,i,k),Form("fFlowQCCorNUAPro[%d][%d][%d]",h,i,k),fPtDiffNBins,fCRCPtBins,"s");
-        fFlowQCCorNUAPro[h][i][k]->Sumw2();
-        fFlowQCList->Add(fFlowQCCorNUAPro[h][i][k]);
+        if(fFlowQCProfileStore) {
+          fFlowQCProfileStore->Book(Form("fFlowQCCorNUAPro[%d][%d][%d]",h,i,k),Form("fFlowQCCorNUAPro[%d][%d][%d]",h,i,k),fPtDiffNBins,fCRCPtBins,"s");
+        } else {
+          fFlowQCCorNUAPro[h][i][k] = new TProfile(Form("fFlowQCCorNUAPro[%d][%d][%d]",h,i,k),Form("fFlowQCCorNUAPro[%d][%d][%d]",h,i,k),fPtDiffNBins,fCRCPtBins,"s");
+          fFlowQCCorNUAPro[h][i][k]->Sumw2();
+          fFlowQCList->Add(fFlowQCCorNUAPro[h][i][k]);
+        }
         fFlowQCCorNUAHist[h][i][k] = new TH1D(Form("fFlowQCCorNUAHist[%d][%d][%d]",h,i,k),Form("fFlowQCCorNUAHist[%d][%d][%d]",h,i,k),fPtDiffNBins,fCRCPtBins);
         fFlowQCCorNUAHist[h][i][k]->Sumw2();
         fFlowQCList->Add(fFlowQCCorNUAHist[h][i][k]);
       }
       for(Int_t k=0; k<fFlowQCNCov; k++) {
-        fFlowQCCorCovPro[h][i][k] = new TProfile(Form("fFlowQCCorCovPro[%d][%d][%d]",h,i,k),Form("fFlowQCCorCovPro[%d][%d][%d]",h,i,k),fPtDiffNBins,fCRCPtBins,"s");
-        fFlowQCCorCovPro[h][i][k]->Sumw2();
-        fFlowQCList->Add(fFlowQCCorCovPro[h][i][k]);
+        if(fFlowQCProfileStore) {
+          fFlowQCProfileStore->Book(Form("fFlowQCCorCovPro[%d][%d][%d]",h,i,k),Form("fFlowQCCorCovPro[%d][%d][%d]",h,i,k),fPtDiffNBins,fCRCPtBins,"s");
+        } else {
+          fFlowQCCorCovPro[h][i][k] = new TProfile(Form("fFlowQCCorCovPro[%d][%d][%d]",h,i,k),Form("fFlowQCCorCovPro[%d][%d][%d]",h,i,k),fPtDiffNBins,fCRCPtBins,"s");
+          fFlowQCCorCovPro[h][i][k]->Sumw2();
+          fFlowQCList->Add(fFlowQCCorCovPro[h][i][k]);
+        }
         fFlowQCCorCovHist[h][i][k] = new TH1D(Form("fFlowQCCorCovHist[%d][%d][%d]",h,i,k),Form("fFlowQCCorCovHist[%d][%d][%d]",h,i,k),fPtDiffNBins,fCRCPtBins);
         fFlowQCCorCovHist[h][i][k]->Sumw2();
         fFlowQCList->Add(fFlowQCCorCovHist[h][i][k]);
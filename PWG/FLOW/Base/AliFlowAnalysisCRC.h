@@ -50,6 +50,7 @@ class AliFlowCommonConstants;
 class AliFlowCommonHist;
 class AliFlowCommonHistResults;
 class AliFlowVector;
+class AliFlowProfileStore;
 
 //==============================================================================================================
 
@@ -218,6 +219,10 @@ public:
   virtual void CalculateCMEZDC();
   virtual void CalculateCRC2Cor();
   virtual void CalculateFlowQC();
+  void FillFlowQCCorPro(Int_t const eg, Int_t const k, Double_t const x, Double_t const y, Double_t const w);
+  void FillFlowQCCorNUAPro(Int_t const eg, Int_t const k, Double_t const x, Double_t const y, Double_t const w);
+  void FillFlowQCCorCovPro(Int_t const eg, Int_t const k, Double_t const x, Double_t const y, Double_t const w);
+  Int_t GetFlowQCProfileId(Int_t const c, Int_t const eg, Int_t const k) const {return (c*fFlowNHarm+eg)*(fFlowQCNPro+fFlowQCNNUA+fFlowQCNCov)+k;};
   virtual void CalculateFlowQCHighOrders();
   virtual void CalculateFlowSPZDC();
   virtual void CalculateFlowSPVZ();
@@ -721,6 +726,8 @@ public:
   Bool_t GetCalculateCME() const {return this->fCalculateCME;};
   void SetCalculateFlowQC(Bool_t const cCRC) {this->fCalculateFlowQC = cCRC;};
   Bool_t GetCalculateFlowQC() const {return this->fCalculateFlowQC;};
+  void SetUseCompactProfiles(Bool_t const cCRC) {this->fUseCompactProfiles = cCRC;};
+  Bool_t GetUseCompactProfiles() const {return this->fUseCompactProfiles;};
   void SetCalculateFlowZDC(Bool_t const cCRC) {this->fCalculateFlowZDC = cCRC;};
   Bool_t GetCalculateFlowZDC() const {return this->fCalculateFlowZDC;};
   void SetCalculateFlowVZ(Bool_t const cCRC) {this->fCalculateFlowVZ = cCRC;};
@@ -1448,6 +1455,7 @@ private:
   Bool_t fCalculateCRCVZ;
   Bool_t fCalculateCRCZDC;
   Bool_t fCalculateFlowQC;
+  Bool_t fUseCompactProfiles; // fill the differential flow QC profiles in an AliFlowProfileStore
   Bool_t fCalculateFlowZDC;
   Bool_t fCalculateFlowVZ;
   Bool_t fUseVZERO;
@@ -1737,6 +1745,7 @@ private:
   
   // Flow QC
   TList *fFlowQCList;    //! QC List
+  AliFlowProfileStore *fFlowQCProfileStore; //! differential flow QC profiles (compact mode)
   const static Int_t fFlowQCNPro = 4;
   const static Int_t fFlowQCNNUA = 12;
   const static Int_t fFlowQCNCov = 8;
@@ -1890,7 +1899,7 @@ private:
   Float_t fMaxDevZN;
   Float_t fZDCGainAlpha;
   
-  ClassDef(AliFlowAnalysisCRC, 44);
+  ClassDef(AliFlowAnalysisCRC, 45);
   
 };
 
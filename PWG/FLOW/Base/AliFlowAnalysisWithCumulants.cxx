@@ -447,16 +447,17 @@ void AliFlowAnalysisWithCumulants::FillGeneratingFunctionsForDifferentTuningPara
   } 
  }
  
+ Bool_t bUseArrays = anEvent->HasTrackArrays(); // track arrays filled once per event by the producer
  // Looping over tracks:
  for(Int_t i=0;i<nPrim;i++)
  {
-  AliFlowTrackSimple *aftsTrack = anEvent->GetTrack(i);
-  if(aftsTrack && aftsTrack->InRPSelection())
+  AliFlowTrackSimple *aftsTrack = bUseArrays ? NULL : anEvent->GetTrack(i);
+  if(bUseArrays ? anEvent->GetArrayInRPSelection(i) : (aftsTrack && aftsTrack->InRPSelection()))
   {
    // Access particle variables and weights:
-   dPhi = aftsTrack->Phi();
-   dPt  = aftsTrack->Pt();
-   dEta = aftsTrack->Eta();
+   dPhi = bUseArrays ? anEvent->GetArrayPhi(i) : aftsTrack->Phi();
+   dPt  = bUseArrays ? anEvent->GetArrayPt(i) : aftsTrack->Pt();
+   dEta = bUseArrays ? anEvent->GetArrayEta(i) : aftsTrack->Eta();
    if(fUsePhiWeights && fnBinsPhi) // determine phi weight for this particle:
    {
     wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
@@ -485,7 +486,7 @@ void AliFlowAnalysisWithCumulants::FillGeneratingFunctionsForDifferentTuningPara
      } // end of for(Int_t p=0;p<pMax[pq];p++)
     } // end for(Int_t pq=0;pq<5;pq++) // 5 different values for set (pMax,qMax)
    } // end of for(Int_t r=0;r<10;r++) // 10 different values for interpolating parameter r0  
-  } // end of if(aftsTrack && aftsTrack->InRPSelection())
+  } // end of if RP
  } // end of for(Int_t i=0;i<nPrim;i++) 
   
  // Store G[p][q]:
@@ -547,17 +548,18 @@ void AliFlowAnalysisWithCumulants::FillGeneratingFunctionForReferenceFlow(AliFlo
  // Cross-checking the number of RPs in current event:
  Int_t crossCheckRP = 0; 
  
+ Bool_t bUseArrays = anEvent->HasTrackArrays(); // track arrays filled once per event by the producer
  // Looping over tracks:
  for(Int_t i=0;i<nPrim;i++)
  {
-  AliFlowTrackSimple *aftsTrack = anEvent->GetTrack(i);
-  if(aftsTrack && aftsTrack->InRPSelection())
+  AliFlowTrackSimple *aftsTrack = bUseArrays ? NULL : anEvent->GetTrack(i);
+  if(bUseArrays ? anEvent->GetArrayInRPSelection(i) : (aftsTrack && aftsTrack->InRPSelection()))
   {
    crossCheckRP++;
    // Access particle variables and weights:
-   dPhi = aftsTrack->Phi();
-   dPt  = aftsTrack->Pt();
-   dEta = aftsTrack->Eta();
+   dPhi = bUseArrays ? anEvent->GetArrayPhi(i) : aftsTrack->Phi();
+   dPt  = bUseArrays ? anEvent->GetArrayPt(i) : aftsTrack->Pt();
+   dEta = bUseArrays ? anEvent->GetArrayEta(i) : aftsTrack->Eta();
    if(fUsePhiWeights && fnBinsPhi) // determine phi weight for this particle:
    {
     wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
@@ -580,7 +582,7 @@ void AliFlowAnalysisWithCumulants::FillGeneratingFunctionForReferenceFlow(AliFlo
    }
    // Fill the profile to calculate <<w^2>>: 
    fAverageOfSquaredWeight->Fill(0.5,pow(wPhi*wPt*wEta,2.),1.); 
-  } // end of if(aftsTrack && aftsTrack->InRPSelection())
+  } // end of if RP
  } // end of for(Int_t i=0;i<nPrim;i++) 
  
  // Cross check # of RPs:
@@ -675,20 +677,23 @@ void AliFlowAnalysisWithCumulants::FillGeneratingFunctionForDiffFlow(AliFlowEven
  
  Int_t nRP = anEvent->GetEventNSelTracksRP(); // nRP = # of particles used to determine the reaction plane
        
+ Bool_t bUseArrays = anEvent->HasTrackArrays(); // track arrays filled once per event by the producer
  // Start the second loop over event in order to evaluate the generating function D[b][p][q] for differential flow: 
  for(Int_t i=0;i<nPrim;i++)
  {
-  AliFlowTrackSimple *aftsTrack = anEvent->GetTrack(i);
-  if(aftsTrack)
+  AliFlowTrackSimple *aftsTrack = bUseArrays ? NULL : anEvent->GetTrack(i);
+  if(bUseArrays || aftsTrack)
   {
-   if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())) continue;
+   Bool_t bRP = bUseArrays ? anEvent->GetArrayInRPSelection(i) : aftsTrack->InRPSelection();
+   Bool_t bPOI = bUseArrays ? anEvent->GetArrayInPOISelection(i) : aftsTrack->InPOISelection();
+   if(!(bRP || bPOI)) continue;
+   // Get azimuthal angle, momentum and pseudorapidity of a particle:
+   dPhi = bUseArrays ? anEvent->GetArrayPhi(i) : aftsTrack->Phi();
+   dPt  = bUseArrays ? anEvent->GetArrayPt(i) : aftsTrack->Pt();
+   dEta = bUseArrays ? anEvent->GetArrayEta(i) : aftsTrack->Eta();
    // Differential flow of POIs:
-   if(aftsTrack->InPOISelection())
+   if(bPOI)
    {
-    // Get azimuthal angle, momentum and pseudorapidity of a particle:
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
     Double_t ptEta[2] = {dPt,dEta};    
    
     // Count number of POIs in pt/eta bin:
@@ -697,7 +702,7 @@ void AliFlowAnalysisWithCumulants::FillGeneratingFunctionForDiffFlow(AliFlowEven
      fNoOfParticlesInBin[1][pe]->Fill(ptEta[pe],ptEta[pe],1.);
     }
   
-    if(!(aftsTrack->InRPSelection())) // particle was flagged only as POI 
+    if(!bRP) // particle was flagged only as POI 
     {
      // Fill generating function:
      for(Int_t p=0;p<pMax;p++)
@@ -722,8 +727,8 @@ void AliFlowAnalysisWithCumulants::FillGeneratingFunctionForDiffFlow(AliFlowEven
        } // end of for(Int_t ri=0;ri<2;ri++) 
       } // end of for(Int_t q=0;q<qMax;q++)
      } // end of for(Int_t p=0;p<pMax;p++)       
-    } // end of if(!(aftsTrack->InRPSelection())) // particle was flagged only as POI 
-    else if(aftsTrack->InRPSelection()) // particle was flagged both as RP and POI 
+    } // end of if(!bRP) // particle was flagged only as POI 
+    else if(bRP) // particle was flagged both as RP and POI 
     {
      // If particle weights were used, get them:
      if(fUsePhiWeights && fnBinsPhi) // determine phi weight for this particle:
@@ -761,15 +766,11 @@ void AliFlowAnalysisWithCumulants::FillGeneratingFunctionForDiffFlow(AliFlowEven
        } // end of for(Int_t ri=0;ri<2;ri++) 
       } // end of for(Int_t q=0;q<qMax;q++)
      } // end of for(Int_t p=0;p<pMax;p++)
-    } // end of else if (aftsTrack->InRPSelection()) // particle was flagged both as RP and POI 
-   } // end of if(aftsTrack->InPOISelection())
+    } // end of else if (bRP) // particle was flagged both as RP and POI 
+   } // end of if(bPOI)
    // Differential flow of RPs:
-   if(aftsTrack->InRPSelection()) 
+   if(bRP) 
    {
-    // Get azimuthal angle, momentum and pseudorapidity of a particle:
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
     Double_t ptEta[2] = {dPt,dEta}; 
     
     // Count number of RPs in pt/eta bin:
@@ -814,8 +815,8 @@ void AliFlowAnalysisWithCumulants::FillGeneratingFunctionForDiffFlow(AliFlowEven
       } // end of for(Int_t ri=0;ri<2;ri++) 
      } // end of for(Int_t q=0;q<qMax;q++)
     } // end of for(Int_t p=0;p<pMax;p++)
-   } // end of if(aftsTrack->InRPSelection()) 
-  } // end of if(aftsTrack)  
+   } // end of if(bRP) 
+  } // end of if(bUseArrays || aftsTrack)  
  } // end of for(Int_t i=0;i<nPrim;i++)
  
 } // end of void AliFlowAnalysisWithCumulants::FillGeneratingFunctionForDiffFlow(AliFlowEventSimple* anEvent)
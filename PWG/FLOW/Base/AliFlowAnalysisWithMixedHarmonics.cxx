@@ -231,19 +231,45 @@ void AliFlowAnalysisWithMixedHarmonics::Make(AliFlowEventSimple* anEvent)
 
  Int_t nRefMult = anEvent->GetReferenceMultiplicity();
 
+ // Track arrays filled once per event by the producer (fall back to the tracks if not there):
+ Bool_t bUseArrays = anEvent->HasTrackArrays();
+ Bool_t bRP = kFALSE; // track is RP
+ Bool_t bPOI = kFALSE; // track is POI
+ Int_t iCharge = 0; // charge
+
  // Start loop over data:
  for(Int_t i=0;i<nPrim;i++) 
  { 
-  aftsTrack=anEvent->GetTrack(i);
-  if(aftsTrack)
+  if(bUseArrays)
+  {
+   bRP = anEvent->GetArrayInRPSelection(i);
+   bPOI = anEvent->GetArrayInPOISelection(i);
+   dPhi = anEvent->GetArrayPhi(i);
+   dPt  = anEvent->GetArrayPt(i);
+   dEta = anEvent->GetArrayEta(i);
+   iCharge = anEvent->GetArrayCharge(i);
+  } else
+    {
+     aftsTrack=anEvent->GetTrack(i);
+     if(!aftsTrack)
+     {
+      cout<<endl;
+      cout<<" WARNING (MH): No particle! (i.e. aftsTrack is a NULL pointer in Make().)"<<endl;
+      cout<<endl;
+      continue;
+     }
+     bRP = aftsTrack->InRPSelection();
+     bPOI = aftsTrack->InPOISelection();
+     dPhi = aftsTrack->Phi();
+     dPt  = aftsTrack->Pt();
+     dEta = aftsTrack->Eta();
+     iCharge = aftsTrack->Charge();
+    }
   {
-   if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())) continue; // consider only tracks which are either RPs or POIs
+   if(!(bRP || bPOI)) continue; // consider only tracks which are either RPs or POIs
    Int_t n = fHarmonic; 
-   if(aftsTrack->InRPSelection()) // checking RP condition:
+   if(bRP) // checking RP condition:
    {    
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
     if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi-weight for this particle:
     {
      wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
@@ -273,31 +299,45 @@ void AliFlowAnalysisWithMixedHarmonics::Make(AliFlowEventSimple* anEvent)
       (*fSpk)(p,k)+=pow(wPhi*wPt*wEta,k);
      }
     }    
-   } // end of if(aftsTrack->InRPSelection())
+   } // end of if(bRP)
    // POIs:
    if(fEvaluateDifferential3pCorrelator)
    {
-    if(aftsTrack->InPOISelection()) // 1st POI
+    if(bPOI) // 1st POI
     {
-     Double_t dPsi1 = aftsTrack->Phi();
-     Double_t dPt1 = aftsTrack->Pt();
-     Double_t dEta1 = aftsTrack->Eta();
-     Int_t iCharge1 = aftsTrack->Charge();
-     Bool_t b1stPOIisAlsoRP = kFALSE;
-     if(aftsTrack->InRPSelection()){b1stPOIisAlsoRP = kTRUE;}
+     Double_t dPsi1 = dPhi;
+     Double_t dPt1 = dPt;
+     Double_t dEta1 = dEta;
+     Int_t iCharge1 = iCharge;
+     Bool_t b1stPOIisAlsoRP = bRP;
      for(Int_t j=0;j<nPrim;j++)
      {
       if(j==i){continue;}
-      aftsTrack=anEvent->GetTrack(j);
-      if(aftsTrack->InPOISelection()) // 2nd POI
+      Double_t dPsi2 = 0.;
+      Double_t dPt2 = 0.; 
+      Double_t dEta2 = 0.;
+      Int_t iCharge2 = 0;
+      Bool_t b2ndPOIisAlsoRP = kFALSE;
+      if(bUseArrays)
       {
-       Double_t dPsi2 = aftsTrack->Phi();
-       Double_t dPt2 = aftsTrack->Pt(); 
-       Double_t dEta2 = aftsTrack->Eta();
-       Int_t iCharge2 = aftsTrack->Charge();
+       if(!anEvent->GetArrayInPOISelection(j)){continue;}
+       dPsi2 = anEvent->GetArrayPhi(j);
+       dPt2 = anEvent->GetArrayPt(j);
+       dEta2 = anEvent->GetArrayEta(j);
+       iCharge2 = anEvent->GetArrayCharge(j);
+       b2ndPOIisAlsoRP = anEvent->GetArrayInRPSelection(j);
+      } else
+        {
+         aftsTrack=anEvent->GetTrack(j);
+         if(!aftsTrack || !aftsTrack->InPOISelection()){continue;}
+         dPsi2 = aftsTrack->Phi();
+         dPt2 = aftsTrack->Pt();
+         dEta2 = aftsTrack->Eta();
+         iCharge2 = aftsTrack->Charge();
+         b2ndPOIisAlsoRP = aftsTrack->InRPSelection();
+        }
+      { // 2nd POI
        if(fOppositeChargesPOI && iCharge1 == iCharge2){continue;}
-       Bool_t b2ndPOIisAlsoRP = kFALSE;
-       if(aftsTrack->InRPSelection()){b2ndPOIisAlsoRP = kTRUE;}
 
        // Fill:Pt
        fRePEBE[0]->Fill((dPt1+dPt2)/2.,TMath::Cos(n*(dPsi1+dPsi2)),1.);
@@ -388,16 +428,11 @@ void AliFlowAnalysisWithMixedHarmonics::Make(AliFlowEventSimple* anEvent)
         fImNITEBE[1][1][2]->Fill((dEta1+dEta2)/2.,TMath::Sin(n*(dPsi2)),1.);
         fImNITEBE[1][1][3]->Fill(TMath::Abs(dEta1-dEta2),TMath::Sin(n*(dPsi2)),1.);       
        }
-      } // end of if(aftsTrack->InPOISelection()) // 2nd POI
+      } // end of 2nd POI
      } // end of for(Int_t j=i+1;j<nPrim;j++)
-    } // end of if(aftsTrack->InPOISelection()) // 1st POI  
+    } // end of if(bPOI) // 1st POI  
    } // end of if(fEvaluateDifferential3pCorrelator)
-  } else // to if(aftsTrack)
-    {
-     cout<<endl;
-     cout<<" WARNING (MH): No particle! (i.e. aftsTrack is a NULL pointer in Make().)"<<endl;
-     cout<<endl;       
-    }
+  }
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
  // Calculate the final expressions for S_{p,k}:
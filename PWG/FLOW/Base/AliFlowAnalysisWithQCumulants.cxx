@@ -379,19 +379,41 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
  AliFlowTrackSimple *aftsTrack = NULL;
  Int_t n = fHarmonic; // shortcut for the harmonic 
+ Bool_t bUseArrays = anEvent->HasTrackArrays(); // track arrays filled once per event by the producer
+ Bool_t bRP = kFALSE; // track is RP
+ Bool_t bPOI = kFALSE; // track is POI
+ Double_t dWeight = 1.; // track weight as stored in the event
  for(Int_t i=0;i<nPrim;i++) 
  { 
   if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
-  aftsTrack=anEvent->GetTrack(i);
-  if(aftsTrack)
+  if(bUseArrays)
+  {
+   bRP = anEvent->GetArrayInRPSelection(i);
+   bPOI = anEvent->GetArrayInPOISelection(i);
+   dPhi = anEvent->GetArrayPhi(i);
+   dPt  = anEvent->GetArrayPt(i);
+   dEta = anEvent->GetArrayEta(i);
+   dWeight = anEvent->GetArrayWeight(i);
+  } else
+    {
+     aftsTrack=anEvent->GetTrack(i);
+     if(!aftsTrack)
+     {
+      printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
+      continue;
+     }
+     bRP = aftsTrack->InRPSelection();
+     bPOI = aftsTrack->InPOISelection();
+     dPhi = aftsTrack->Phi();
+     dPt  = aftsTrack->Pt();
+     dEta = aftsTrack->Eta();
+     dWeight = aftsTrack->Weight();
+    }
   {
-   if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())){continue;} // safety measure: consider only tracks which are RPs or POIs
-   if(aftsTrack->InRPSelection()) // RP condition:
+   if(!(bRP || bPOI)){continue;} // safety measure: consider only tracks which are RPs or POIs
+   if(bRP) // RP condition:
    {    
     nCounterNoRPs++;
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
     if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi weight for this particle:
     {
      wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
@@ -407,7 +429,7 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     // Access track weight:
     if(fUseTrackWeights)
     {
-     wTrack = aftsTrack->Weight(); 
+     wTrack = dWeight; 
     }
     // Calculate Re[Q_{m*n,k}] and Im[Q_{m*n,k}] for this event (m = 1,2,...,12, k = 0,1,...,8):
     for(Int_t m=0;m<12;m++) // to be improved - hardwired 6 
@@ -460,7 +482,7 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
       } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
      } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
      // Checking if RP particle is also POI particle:      
-     if(aftsTrack->InPOISelection())
+     if(bPOI)
      {
       // Calculate q_{m*n,k} and s_{p,k} ('q-vector' and 's' for RPs && POIs): 
       for(Int_t k=0;k<9;k++) // to be improved - hardwired 9
@@ -490,34 +512,31 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
         } // end of if(fCalculate2DDiffFlow)
        } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
       } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-     } // end of if(aftsTrack->InPOISelection())  
+     } // end of if(bPOI)  
     } // end of if(fCalculateDiffFlow || fCalculate2DDiffFlow)         
-   } // end of if(pTrack->InRPSelection())
-   if(aftsTrack->InPOISelection())
+   } // end of if(bRP)
+   if(bPOI)
    {
-    dPhi = aftsTrack->Phi();
-    dPt  = aftsTrack->Pt();
-    dEta = aftsTrack->Eta();
     wPhi = 1.;
     wPt  = 1.;
     wEta = 1.;
     wTrack = 1.;
-    if(fUsePhiWeights && fPhiWeights && fnBinsPhi && aftsTrack->InRPSelection()) // determine phi weight for POI && RP particle:
+    if(fUsePhiWeights && fPhiWeights && fnBinsPhi && bRP) // determine phi weight for POI && RP particle:
     {
      wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
     }
-    if(fUsePtWeights && fPtWeights && fnBinsPt && aftsTrack->InRPSelection()) // determine pt weight for POI && RP particle:
+    if(fUsePtWeights && fPtWeights && fnBinsPt && bRP) // determine pt weight for POI && RP particle:
     {
      wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
     }              
-    if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && aftsTrack->InRPSelection()) // determine eta weight for POI && RP particle: 
+    if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && bRP) // determine eta weight for POI && RP particle: 
     {
      wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
     }      
     // Access track weight for POI && RP particle:
-    if(aftsTrack->InRPSelection() && fUseTrackWeights)
+    if(bRP && fUseTrackWeights)
     {
-     wTrack = aftsTrack->Weight(); 
+     wTrack = dWeight; 
     }
     ptEta[0] = dPt;
     ptEta[1] = dEta;
@@ -541,11 +560,8 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
       } // end of if(fCalculate2DDiffFlow)
      } // end of for(Int_t m=0;m<4;m++) // to be improved - hardwired 4
     } // end of for(Int_t k=0;k<9;k++) // to be improved - hardwired 9    
-   } // end of if(pTrack->InPOISelection())    
-  } else // to if(aftsTrack)
-    {
-     printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
-    }
+   } // end of if(bPOI)    
+  }
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
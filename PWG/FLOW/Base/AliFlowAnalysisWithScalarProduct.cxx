@@ -372,14 +372,34 @@ void AliFlowAnalysisWithScalarProduct::Make(AliFlowEventSimple* anEvent) {
   fHistProNUAq->Fill(6.,vQm.X()/dNq,dWq);
 
   //loop over the tracks of the event
+  //the kinematics and tags come from the track arrays if the producer filled them,
+  //the track itself is only needed to subtract it (and its daughters) from Q
   AliFlowTrackSimple*   pTrack = NULL; 
+  Bool_t bUseArrays = anEvent->HasTrackArrays();
   Int_t iNumberOfTracks = anEvent->NumberOfTracks(); 
   for (Int_t i=0;i<iNumberOfTracks;i++) {
-    pTrack = anEvent->GetTrack(i) ; 
-    if (!pTrack) continue;
-    Double_t dPhi = pTrack->Phi();
-    Double_t dPt  = pTrack->Pt();
-    Double_t dEta = pTrack->Eta();
+    Double_t dPhi, dPt, dEta;
+    Bool_t bRP, bPOI, bInSubevent[2];
+    if (bUseArrays) {
+      dPhi = anEvent->GetArrayPhi(i);
+      dPt  = anEvent->GetArrayPt(i);
+      dEta = anEvent->GetArrayEta(i);
+      bRP  = anEvent->GetArrayInRPSelection(i);
+      bPOI = anEvent->GetArrayInPOISelection(i,fPOItype);
+      bInSubevent[0] = anEvent->GetArrayInSubevent(i,0);
+      bInSubevent[1] = anEvent->GetArrayInSubevent(i,1);
+      pTrack = NULL;
+    } else {
+      pTrack = anEvent->GetTrack(i) ; 
+      if (!pTrack) continue;
+      dPhi = pTrack->Phi();
+      dPt  = pTrack->Pt();
+      dEta = pTrack->Eta();
+      bRP  = pTrack->InRPSelection();
+      bPOI = pTrack->InPOISelection(fPOItype);
+      bInSubevent[0] = pTrack->InSubevent(0);
+      bInSubevent[1] = pTrack->InSubevent(1);
+    }
 
     //calculate vU
     TVector2 vU;
@@ -402,7 +422,7 @@ void AliFlowAnalysisWithScalarProduct::Make(AliFlowEventSimple* anEvent) {
 
     //remove track if in subevent
     for(Int_t inSubEvent=0; inSubEvent<2; ++inSubEvent) {
-      if( !pTrack->InSubevent( inSubEvent ) )
+      if( !bInSubevent[inSubEvent] )
         continue;
       if(inSubEvent==0)
         if( (fTotalQvector%2)!=1 )
@@ -426,6 +446,7 @@ void AliFlowAnalysisWithScalarProduct::Make(AliFlowEventSimple* anEvent) {
       //subtrack the track from the Q vector, but only if it was used to construct this
       //Q vector: i.e. check wether it has the same tags and is in the same subevent
       //this is especially important for the daughters (as for the mother it is already checked)
+      if(!pTrack) pTrack = anEvent->GetTrack(i);
       Int_t numberOfsubtractedDaughters=vQm.SubtractTrackWithDaughters(pTrack,dW);
       
       if(!fMinimalBook) {
@@ -455,9 +476,9 @@ void AliFlowAnalysisWithScalarProduct::Make(AliFlowEventSimple* anEvent) {
 
     //fill the profile histograms
     for(Int_t iPOI=0; iPOI!=2; ++iPOI) {
-      if( (iPOI==0)&&(!pTrack->InRPSelection()) )
+      if( (iPOI==0)&&(!bRP) )
         continue;
-      if( (iPOI==1)&&(!pTrack->InPOISelection(fPOItype)) )
+      if( (iPOI==1)&&(!bPOI) )
         continue;
       fHistProUQ[iPOI][0]->Fill(dPt ,dUQ/dNq,dWq); //Fill (uQ/Nq') with weight (Nq')
       fHistProUQ[iPOI][1]->Fill(dEta,dUQ/dNq,dWq); //Fill (uQ/Nq') with weight (Nq')
@@ -588,18 +588,38 @@ Bool_t AliFlowCommonHist::FillControlHistograms(AliFlowEventSimple* anEvent,TLis
   
   Int_t iNumberOfTracks = anEvent->NumberOfTracks();
   AliFlowTrackSimple* pTrack = NULL;     
+  Bool_t bUseArrays = anEvent->HasTrackArrays(); //track arrays shared by all the methods, if filled
+  Bool_t bRP = kFALSE, bSub0 = kFALSE, bSub1 = kFALSE, bPOI = kFALSE;
+  Double_t dMass = 0.;
 
   for (Int_t i=0;i<iNumberOfTracks;i++) {
-    pTrack = anEvent->GetTrack(i);
-    if (pTrack ) {
-      dWeight = pTrack->Weight();
-      dPt = pTrack->Pt();
-      dPhi = pTrack->Phi();
+    pTrack = bUseArrays ? NULL : anEvent->GetTrack(i);
+    if (bUseArrays || pTrack) {
+      if (bUseArrays) {
+	dWeight = anEvent->GetArrayWeight(i);
+	dPt = anEvent->GetArrayPt(i);
+	dPhi = anEvent->GetArrayPhi(i);
+	dEta = anEvent->GetArrayEta(i);
+	dMass = anEvent->GetArrayMass(i);
+	bRP = anEvent->GetArrayInRPSelection(i);
+	bSub0 = anEvent->GetArrayInSubevent(i,0);
+	bSub1 = anEvent->GetArrayInSubevent(i,1);
+	bPOI = anEvent->GetArrayInPOISelection(i);
+      } else {
+	dWeight = pTrack->Weight();
+	dPt = pTrack->Pt();
+	dPhi = pTrack->Phi();
+	dEta = pTrack->Eta();
+	dMass = pTrack->Mass();
+	bRP = pTrack->InRPSelection();
+	bSub0 = pTrack->InSubevent(0);
+	bSub1 = pTrack->InSubevent(1);
+	bPOI = pTrack->InPOISelection();
+      }
       if (dPhi<0.) dPhi+=2*TMath::Pi();
-      dEta = pTrack->Eta();
 
       //weights are only used for the RP selection
-      if (pTrack->InRPSelection()){
+      if (bRP){
 	// determine Phi weight:
 	if(phiWeights && nBinsPhi) {
 	  dWPhi = phiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*nBinsPhi/TMath::TwoPi())));
@@ -629,7 +649,7 @@ Bool_t AliFlowCommonHist::FillControlHistograms(AliFlowEventSimple* anEvent,TLis
 	//count
 	dMultRP += dW;
       }
-      if (pTrack->InRPSelection() && pTrack->InSubevent(0)) {
+      if (bRP && bSub0) {
 	// determine Phi weight:
 	if(phiWeightsSub0 && nBinsPhiSub0){
 	  dWPhi = phiWeightsSub0->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*nBinsPhiSub0/TMath::TwoPi())));
@@ -653,7 +673,7 @@ Bool_t AliFlowCommonHist::FillControlHistograms(AliFlowEventSimple* anEvent,TLis
 	//eta
 	if(!fBookOnlyBasic){fHistEtaSub0 ->Fill(dEta,dW);}
       }
-      if (pTrack->InRPSelection() && pTrack->InSubevent(1)) {
+      if (bRP && bSub1) {
 	// determine Phi weight:
 	if(phiWeightsSub1 && nBinsPhiSub1){
 	  dWPhi = phiWeightsSub1->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*nBinsPhiSub1/TMath::TwoPi())));
@@ -677,7 +697,7 @@ Bool_t AliFlowCommonHist::FillControlHistograms(AliFlowEventSimple* anEvent,TLis
 	//eta
 	if(!fBookOnlyBasic){fHistEtaSub1 -> Fill(dEta,dW);}
       }
-      if (pTrack->InPOISelection()){
+      if (bPOI){
 
 	Double_t dW = dWeight; //no pt, phi or eta weights
 
@@ -692,7 +712,7 @@ Bool_t AliFlowCommonHist::FillControlHistograms(AliFlowEventSimple* anEvent,TLis
 	//mean pt
 	fHistProMeanPtperBin ->Fill(dPt,dPt,dW);
 	//mass
-	fHistMassPOI->Fill(pTrack->Mass(),dPt,dW);
+	fHistMassPOI->Fill(dMass,dPt,dW);
 	//count
 	dMultPOI += dW;
       }
@@ -82,6 +82,19 @@ AliFlowEventSimple::AliFlowEventSimple():
   fRun(-1),
   fZNCM(0.),
   fZNAM(0.),
+  fTrackArraysFilled(kFALSE),
+  fArrayPhi(),
+  fArrayPt(),
+  fArrayEta(),
+  fArrayWeight(),
+  fArrayMass(),
+  fArrayCharge(),
+  fArrayPOItype(),
+  fArraySubevent(),
+  fCachedQHarmonic(),
+  fCachedQWeights(),
+  fCachedQFlags(),
+  fCachedQ(),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(NULL)
 {
@@ -132,6 +145,19 @@ AliFlowEventSimple::AliFlowEventSimple( Int_t n,
   fRun(-1),
   fZNCM(0.),
   fZNAM(0.),
+  fTrackArraysFilled(kFALSE),
+  fArrayPhi(),
+  fArrayPt(),
+  fArrayEta(),
+  fArrayWeight(),
+  fArrayMass(),
+  fArrayCharge(),
+  fArrayPOItype(),
+  fArraySubevent(),
+  fCachedQHarmonic(),
+  fCachedQWeights(),
+  fCachedQFlags(),
+  fCachedQ(),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -186,6 +212,19 @@ AliFlowEventSimple::AliFlowEventSimple(const AliFlowEventSimple& anEvent):
   fZNAQ(anEvent.fZNAQ),
   fZNCM(anEvent.fZNCM),
   fZNAM(anEvent.fZNAM),
+  fTrackArraysFilled(kFALSE),
+  fArrayPhi(),
+  fArrayPt(),
+  fArrayEta(),
+  fArrayWeight(),
+  fArrayMass(),
+  fArrayCharge(),
+  fArrayPOItype(),
+  fArraySubevent(),
+  fCachedQHarmonic(),
+  fCachedQWeights(),
+  fCachedQFlags(),
+  fCachedQ(),
   fNumberOfPOItypes(anEvent.fNumberOfPOItypes),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -214,6 +253,7 @@ void AliFlowEventSimple::SetNumberOfPOIs( Int_t numberOfPOIs, Int_t poiType)
   }
   
   fNumberOfPOIs[poiType] = numberOfPOIs;
+  ClearTrackArrays();
 }
 
 //-----------------------------------------------------------------------
@@ -222,6 +262,7 @@ void AliFlowEventSimple::IncrementNumberOfPOIs(Int_t poiType)
 
   if (poiType>=fNumberOfPOItypes) SetNumberOfPOIs(0,poiType);
   fNumberOfPOIs[poiType]++;
+  ClearTrackArrays();
 }
 
 //-----------------------------------------------------------------------
@@ -270,6 +311,7 @@ AliFlowEventSimple& AliFlowEventSimple::operator=(const AliFlowEventSimple& anEv
     fVtxPos[i] = anEvent.fVtxPos[i];
   }
   delete [] fShuffledIndexes;
+  ClearTrackArrays();
   return *this;
 }
 
@@ -404,6 +446,7 @@ void AliFlowEventSimple::ShuffleTracks()
     for (Int_t j=0; j<fNumberOfTracks; j++) { fShuffledIndexes[j]=j; }
   }
   //shuffle
+  ClearTrackArrays();
   std::random_shuffle(&fShuffledIndexes[0], &fShuffledIndexes[fNumberOfTracks]);
   Printf("Tracks shuffled! tracks: %i",fNumberOfTracks);
 }
@@ -431,6 +474,7 @@ void AliFlowEventSimple::TrackAdded()
 {
   //book keeping after a new track has been added
   fNumberOfTracks++;
+  ClearTrackArrays();
   if (fShuffledIndexes)
   {
     delete [] fShuffledIndexes;
@@ -449,6 +493,101 @@ AliFlowTrackSimple* AliFlowEventSimple::MakeNewTrack()
    return t;
 }
 
+//-----------------------------------------------------------------------
+Bool_t AliFlowEventSimple::BuildTrackArrays()
+{
+  //fill contiguous arrays with the kinematics, weights and tags of the tracks,
+  //in the GetTrack() order, to be shared by all the methods run on this event.
+  //They are dropped when the event is changed through its methods, tracks
+  //modified directly must be followed by ClearTrackArrays().
+  //Returns kFALSE (arrays not filled) if the event has a missing track.
+  ClearTrackArrays();
+  fArrayPhi.resize(fNumberOfTracks);
+  fArrayPt.resize(fNumberOfTracks);
+  fArrayEta.resize(fNumberOfTracks);
+  fArrayWeight.resize(fNumberOfTracks);
+  fArrayMass.resize(fNumberOfTracks);
+  fArrayCharge.resize(fNumberOfTracks);
+  fArrayPOItype.resize(fNumberOfTracks);
+  fArraySubevent.resize(fNumberOfTracks);
+  for (Int_t i=0; i<fNumberOfTracks; i++)
+  {
+    AliFlowTrackSimple* pTrack = GetTrack(i);
+    if (!pTrack)
+    {
+      ClearTrackArrays();
+      return kFALSE;
+    }
+    fArrayPhi[i]    = pTrack->Phi();
+    fArrayPt[i]     = pTrack->Pt();
+    fArrayEta[i]    = pTrack->Eta();
+    fArrayWeight[i] = pTrack->Weight();
+    fArrayMass[i]   = pTrack->Mass();
+    fArrayCharge[i] = pTrack->Charge();
+    const TBits* poiType = pTrack->GetPOItype();
+    const TBits* subevent = pTrack->GetSubeventBits();
+    UInt_t poiBits = 0, subeventBits = 0;
+    for (UInt_t j=0; j<32 && j<poiType->GetNbits(); j++)
+      if (poiType->TestBitNumber(j)) poiBits |= 1u<<j;
+    for (UInt_t j=0; j<32 && j<subevent->GetNbits(); j++)
+      if (subevent->TestBitNumber(j)) subeventBits |= 1u<<j;
+    fArrayPOItype[i]  = poiBits;
+    fArraySubevent[i] = subeventBits;
+  }
+  fTrackArraysFilled = kTRUE;
+  return kTRUE;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventSimple::ClearTrackArrays()
+{
+  //drop the track arrays and the Q-vectors computed from them,
+  //nothing to do if they are not filled (e.g. while tracks are being added)
+  if (!fTrackArraysFilled) return;
+  fTrackArraysFilled = kFALSE;
+  fArrayPhi.clear();
+  fArrayPt.clear();
+  fArrayEta.clear();
+  fArrayWeight.clear();
+  fArrayMass.clear();
+  fArrayCharge.clear();
+  fArrayPOItype.clear();
+  fArraySubevent.clear();
+  fCachedQHarmonic.clear();
+  fCachedQWeights.clear();
+  fCachedQFlags.clear();
+  fCachedQ.clear();
+}
+
+//-----------------------------------------------------------------------
+Bool_t AliFlowEventSimple::FindCachedQ(Int_t n, TList* weightsList, Int_t flags, AliFlowVector& vQ) const
+{
+  //look up a Q-vector already computed from the current track arrays
+  for (UInt_t i=0; i<fCachedQHarmonic.size(); i++)
+  {
+    if (fCachedQHarmonic[i]!=n || fCachedQWeights[i]!=weightsList || fCachedQFlags[i]!=flags) continue;
+    vQ.Set(fCachedQ[3*i],fCachedQ[3*i+1]);
+    vQ.SetMult(fCachedQ[3*i+2]);
+    vQ.SetHarmonic(n);
+    vQ.SetPOItype(AliFlowTrackSimple::kRP);
+    vQ.SetSubeventNumber((flags>>3)-1);
+    return kTRUE;
+  }
+  return kFALSE;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventSimple::CacheQ(Int_t n, TList* weightsList, Int_t flags, const AliFlowVector& vQ)
+{
+  //keep a Q-vector computed from the current track arrays
+  fCachedQHarmonic.push_back(n);
+  fCachedQWeights.push_back(weightsList);
+  fCachedQFlags.push_back(flags);
+  fCachedQ.push_back(vQ.X());
+  fCachedQ.push_back(vQ.Y());
+  fCachedQ.push_back(vQ.GetMult());
+}
+
 //-----------------------------------------------------------------------
 AliFlowVector AliFlowEventSimple::GetQ( Int_t n, 
                                         TList *weightsList, 
@@ -485,6 +624,10 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
   TH1D *ptWeights  = NULL;
   TH1D *etaWeights = NULL;
 
+  // same Q-vector already computed for the current track arrays:
+  Int_t iCacheFlags = weightsList ? (usePhiWeights ? 1 : 0) | (usePtWeights ? 2 : 0) | (useEtaWeights ? 4 : 0) : 0;
+  if(fTrackArraysFilled && FindCachedQ(iOrder, weightsList, iCacheFlags, vQ)) return vQ;
+
   if(weightsList)
   {
     if(usePhiWeights)
@@ -512,48 +655,55 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
     }
   } // end of if(weightsList)
 
-  // loop over tracks
+  // loop over tracks (the track arrays follow the collection unless the tracks are shuffled)
+  Bool_t useArrays = fTrackArraysFilled && !fShuffleTracks;
   for(Int_t i=0; i<fNumberOfTracks; i++)
   {
-    pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
-    if(pTrack)
+    if(useArrays)
+    {
+      if(!GetArrayInRPSelection(i)) continue;
+      dPhi    = fArrayPhi[i];
+      dPt     = fArrayPt[i];
+      dEta    = fArrayEta[i];
+      dWeight = fArrayWeight[i];
+    }
+    else
     {
-      if(pTrack->InRPSelection())
+      pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
+      if(!pTrack)
       {
-        dPhi = pTrack->Phi();
-        dPt  = pTrack->Pt();
-        dEta = pTrack->Eta();
-	      dWeight = pTrack->Weight();
-
-        // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
-        if(phiWeights && nBinsPhi)
-        {
-          wPhi = phiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*nBinsPhi/TMath::TwoPi())));
-        }
-        // determine v'(pt) weight:
-        if(ptWeights && dBinWidthPt)
-        {
-          wPt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
-        }
-        // determine v'(eta) weight:
-        if(etaWeights && dBinWidthEta)
-        {
-          wEta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
-        }
-
-        // building up the weighted Q-vector:
-        dQX += dWeight*wPhi*wPt*wEta*TMath::Cos(iOrder*dPhi);
-        dQY += dWeight*wPhi*wPt*wEta*TMath::Sin(iOrder*dPhi);
-
-        // weighted multiplicity:
-        sumOfWeights += dWeight*wPhi*wPt*wEta;
+        cerr << "no particle!!!"<<endl;
+        continue;
+      }
+      if(!pTrack->InRPSelection()) continue;
+      dPhi    = pTrack->Phi();
+      dPt     = pTrack->Pt();
+      dEta    = pTrack->Eta();
+      dWeight = pTrack->Weight();
+    }
 
-      } // end of if (pTrack->InRPSelection())
-    } // end of if (pTrack)
-    else
+    // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
+    if(phiWeights && nBinsPhi)
+    {
+      wPhi = phiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*nBinsPhi/TMath::TwoPi())));
+    }
+    // determine v'(pt) weight:
+    if(ptWeights && dBinWidthPt)
     {
-      cerr << "no particle!!!"<<endl;
+      wPt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
     }
+    // determine v'(eta) weight:
+    if(etaWeights && dBinWidthEta)
+    {
+      wEta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
+    }
+
+    // building up the weighted Q-vector:
+    dQX += dWeight*wPhi*wPt*wEta*TMath::Cos(iOrder*dPhi);
+    dQY += dWeight*wPhi*wPt*wEta*TMath::Sin(iOrder*dPhi);
+
+    // weighted multiplicity:
+    sumOfWeights += dWeight*wPhi*wPt*wEta;
   } // loop over particles
 
   vQ.Set(dQX,dQY);
@@ -562,6 +712,8 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
   vQ.SetPOItype(AliFlowTrackSimple::kRP);
   vQ.SetSubeventNumber(-1);
 
+  if(fTrackArraysFilled) CacheQ(iOrder, weightsList, iCacheFlags, vQ);
+
   return vQ;
 
 }
@@ -604,6 +756,11 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
   TH1D* ptWeights  = NULL;
   TH1D* etaWeights = NULL;
 
+  // same Q-vectors already computed for the current track arrays:
+  Int_t iCacheFlags = weightsList ? (usePhiWeights ? 1 : 0) | (usePtWeights ? 2 : 0) | (useEtaWeights ? 4 : 0) : 0;
+  if(fTrackArraysFilled && FindCachedQ(iOrder, weightsList, iCacheFlags | (1<<3), Qarray[0])
+     && FindCachedQ(iOrder, weightsList, iCacheFlags | (2<<3), Qarray[1])) return;
+
   if(weightsList)
   {
     if(usePhiWeights)
@@ -638,64 +795,73 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
   } // end of if(weightsList)
 
   //loop over the two subevents
+  Bool_t useArrays = fTrackArraysFilled && !fShuffleTracks; // see GetQ()
   for (Int_t s=0; s<2; s++)
   {
     // loop over tracks
     for(Int_t i=0; i<fNumberOfTracks; i++)
     {
-      pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
-      if(!pTrack)
+      if(useArrays)
       {
-        cerr << "no particle!!!"<<endl;
-        continue;
+        if(!(GetArrayInRPSelection(i) && GetArrayInSubevent(i,s))) continue;
+        dPhi    = fArrayPhi[i];
+        dPt     = fArrayPt[i];
+        dEta    = fArrayEta[i];
+        dWeight = fArrayWeight[i];
       }
-      if(pTrack->InRPSelection() && (pTrack->InSubevent(s)))
+      else
       {
+        pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
+        if(!pTrack)
+        {
+          cerr << "no particle!!!"<<endl;
+          continue;
+        }
+        if(!(pTrack->InRPSelection() && pTrack->InSubevent(s))) continue;
         dPhi    = pTrack->Phi();
         dPt     = pTrack->Pt();
         dEta    = pTrack->Eta();
         dWeight = pTrack->Weight();
+      }
 
-        // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
-        //subevent 0
-        if(s == 0)  { 
-          if(phiWeightsSub0 && iNbinsPhiSub0)  {
-            Int_t phiBin = 1+(Int_t)(TMath::Floor(dPhi*iNbinsPhiSub0/TMath::TwoPi()));
-            //use the phi value at the center of the bin
-            dPhi  = phiWeightsSub0->GetBinCenter(phiBin);
-            dWphi = phiWeightsSub0->GetBinContent(phiBin);
-          }
-        } 
-        //subevent 1
-        else if (s == 1) { 
-          if(phiWeightsSub1 && iNbinsPhiSub1) {
-            Int_t phiBin = 1+(Int_t)(TMath::Floor(dPhi*iNbinsPhiSub1/TMath::TwoPi()));
-            //use the phi value at the center of the bin
-            dPhi  = phiWeightsSub1->GetBinCenter(phiBin);
-            dWphi = phiWeightsSub1->GetBinContent(phiBin);
-          } 
-        }
-
-        // determine v'(pt) weight:
-        if(ptWeights && dBinWidthPt)
-        {
-          dWpt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
+      // determine Phi weight: (to be improved, I should here only access it + the treatment of gaps in the if statement)
+      //subevent 0
+      if(s == 0)  { 
+        if(phiWeightsSub0 && iNbinsPhiSub0)  {
+          Int_t phiBin = 1+(Int_t)(TMath::Floor(dPhi*iNbinsPhiSub0/TMath::TwoPi()));
+          //use the phi value at the center of the bin
+          dPhi  = phiWeightsSub0->GetBinCenter(phiBin);
+          dWphi = phiWeightsSub0->GetBinContent(phiBin);
         }
+      } 
+      //subevent 1
+      else if (s == 1) { 
+        if(phiWeightsSub1 && iNbinsPhiSub1) {
+          Int_t phiBin = 1+(Int_t)(TMath::Floor(dPhi*iNbinsPhiSub1/TMath::TwoPi()));
+          //use the phi value at the center of the bin
+          dPhi  = phiWeightsSub1->GetBinCenter(phiBin);
+          dWphi = phiWeightsSub1->GetBinContent(phiBin);
+        } 
+      }
 
-        // determine v'(eta) weight:
-        if(etaWeights && dBinWidthEta)
-        {
-          dWeta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
-        }
+      // determine v'(pt) weight:
+      if(ptWeights && dBinWidthPt)
+      {
+        dWpt=ptWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-dPtMin)/dBinWidthPt)));
+      }
 
-        // building up the weighted Q-vector:
-        dQX += dWeight*dWphi*dWpt*dWeta*TMath::Cos(iOrder*dPhi);
-        dQY += dWeight*dWphi*dWpt*dWeta*TMath::Sin(iOrder*dPhi);
+      // determine v'(eta) weight:
+      if(etaWeights && dBinWidthEta)
+      {
+        dWeta=etaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-dEtaMin)/dBinWidthEta)));
+      }
 
-        // weighted multiplicity:
-        sumOfWeights+=dWeight*dWphi*dWpt*dWeta;
+      // building up the weighted Q-vector:
+      dQX += dWeight*dWphi*dWpt*dWeta*TMath::Cos(iOrder*dPhi);
+      dQY += dWeight*dWphi*dWpt*dWeta*TMath::Sin(iOrder*dPhi);
 
-      } // end of if (pTrack->InRPSelection())
+      // weighted multiplicity:
+      sumOfWeights+=dWeight*dWphi*dWpt*dWeta;
     } // loop over particles
     
     Qarray[s].Set(dQX,dQY);
@@ -703,6 +869,7 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
     Qarray[s].SetHarmonic(iOrder);
     Qarray[s].SetPOItype(AliFlowTrackSimple::kRP);
     Qarray[s].SetSubeventNumber(s);
+    if(fTrackArraysFilled) CacheQ(iOrder, weightsList, iCacheFlags | ((s+1)<<3), Qarray[s]);
 
     //reset
     sumOfWeights = 0.;
@@ -828,6 +995,19 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
   fRun(-1),
   fZNCM(0.),
   fZNAM(0.),
+  fTrackArraysFilled(kFALSE),
+  fArrayPhi(),
+  fArrayPt(),
+  fArrayEta(),
+  fArrayWeight(),
+  fArrayMass(),
+  fArrayCharge(),
+  fArrayPOItype(),
+  fArraySubevent(),
+  fCachedQHarmonic(),
+  fCachedQWeights(),
+  fCachedQFlags(),
+  fCachedQ(),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -920,6 +1100,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
                                             Double_t etaMaxB )
 {
   //Flag two subevents in given eta ranges
+  ClearTrackArrays();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -935,6 +1116,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
 void AliFlowEventSimple::TagSubeventsByCharge()
 {
   //Flag two subevents in given eta ranges
+  ClearTrackArrays();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1088,6 +1270,7 @@ void AliFlowEventSimple::AddV2( TF2* ptEtaDepV2 )
 void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
 {
   //tag tracks as reference particles (RPs)
+  ClearTrackArrays();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1110,6 +1293,7 @@ void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
 void AliFlowEventSimple::TagPOI( const AliFlowTrackSimpleCuts* cuts, Int_t poiType )
 {
   //tag tracks as particles of interest (POIs)
+  ClearTrackArrays();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1143,6 +1327,7 @@ void AliFlowEventSimple::DefineDeadZone( Double_t etaMin,
 {
   //mark tracks in given eta-phi region as dead
   //by resetting the flow bits
+  ClearTrackArrays();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1175,6 +1360,7 @@ Int_t AliFlowEventSimple::CleanUpDeadTracks()
   fTrackCollection->Compress(); //clean up empty slots
   fNumberOfTracks-=ncleaned; //update number of tracks
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  ClearTrackArrays();
   return ncleaned;
 }
 
@@ -1214,4 +1400,5 @@ void AliFlowEventSimple::ClearFast()
   fAfterBurnerPrecision = 0.001;
   fUserModified = kFALSE;
   delete [] fShuffledIndexes; fShuffledIndexes=NULL;
+  ClearTrackArrays();
 }
@@ -16,10 +16,12 @@
 #ifndef ALIFLOWEVENTSIMPLE_H
 #define ALIFLOWEVENTSIMPLE_H
 
+#include <vector>
 #include "TObject.h"
 #include "TParameter.h"
 #include "TMath.h"
 #include "AliFlowVector.h"
+class TList;
 class TTree;
 class TF1;
 class TF2;
@@ -82,9 +84,9 @@ class AliFlowEventSimple: public TObject {
   Bool_t   IsSetMCReactionPlaneAngle() const        { return fMCReactionPlaneAngleIsSet; }
   void     SetAfterBurnerPrecision(Double_t p)      { fAfterBurnerPrecision=p; }
   Double_t GetAfterBurnerPrecision() const          { return fAfterBurnerPrecision; }
-  void     SetUserModified(Bool_t s=kTRUE)          { fUserModified=s; }
+  void     SetUserModified(Bool_t s=kTRUE)          { fUserModified=s; ClearTrackArrays(); }
   Bool_t   IsUserModified() const                   { return fUserModified; }
-  void     SetShuffleTracks(Bool_t b)               {fShuffleTracks=b;}
+  void     SetShuffleTracks(Bool_t b)               {fShuffleTracks=b; ClearTrackArrays();}
   void     ShuffleTracks();
 
   void ResolutionPt(Double_t res);
@@ -117,6 +119,22 @@ class AliFlowEventSimple: public TObject {
   void TrackAdded();
   AliFlowTrackSimple* MakeNewTrack();
  
+  // contiguous per-track arrays (GetTrack order) of the event, built once and
+  // shared by all the methods run on the event; while they are filled the
+  // tracks must not be modified and GetQ/Get2Qsub results are reused
+  Bool_t   BuildTrackArrays();
+  void     ClearTrackArrays();
+  Bool_t   HasTrackArrays() const                   { return fTrackArraysFilled; }
+  Double_t GetArrayPhi(Int_t i) const               { return fArrayPhi[i]; }
+  Double_t GetArrayPt(Int_t i) const                { return fArrayPt[i]; }
+  Double_t GetArrayEta(Int_t i) const               { return fArrayEta[i]; }
+  Double_t GetArrayWeight(Int_t i) const            { return fArrayWeight[i]; }
+  Double_t GetArrayMass(Int_t i) const              { return fArrayMass[i]; }
+  Int_t    GetArrayCharge(Int_t i) const            { return fArrayCharge[i]; }
+  Bool_t   GetArrayInRPSelection(Int_t i) const     { return (fArrayPOItype[i] & 1u) != 0; }
+  Bool_t   GetArrayInPOISelection(Int_t i, Int_t poiType=1) const { return poiType<32 && ((fArrayPOItype[i] >> poiType) & 1u); }
+  Bool_t   GetArrayInSubevent(Int_t i, Int_t s) const { return s<32 && ((fArraySubevent[i] >> s) & 1u); }
+
   virtual AliFlowVector GetQ(Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void Get2Qsub(AliFlowVector* Qarray, Int_t n=2, TList *weightsList=NULL, Bool_t usePhiWeights=kFALSE, Bool_t usePtWeights=kFALSE, Bool_t useEtaWeights=kFALSE);
   virtual void GetZDC2Qsub(AliFlowVector* Qarray);
@@ -147,6 +165,9 @@ class AliFlowEventSimple: public TObject {
                          Double_t etaMin=-1.0,
                          Double_t etaMax= 1.0 );
 
+  Bool_t FindCachedQ(Int_t n, TList* weightsList, Int_t flags, AliFlowVector& vQ) const;
+  void   CacheQ(Int_t n, TList* weightsList, Int_t flags, const AliFlowVector& vQ);
+
   //data members
   TObjArray*              fTrackCollection;           //-> collection of tracks
   Int_t                   fReferenceMultiplicity;     // reference multiplicity
@@ -182,12 +203,25 @@ class AliFlowEventSimple: public TObject {
   Double_t                fZNCM;                      // total energy from ZNC-C
   Double_t                fZNAM;                      // total energy from ZNC-A
   Double_t                fVtxPos[3];                 // Primary vertex position (x,y,z)
+  Bool_t                  fTrackArraysFilled;         //! are the track arrays filled?
+  std::vector<Double_t>   fArrayPhi;                  //! phi of the tracks
+  std::vector<Double_t>   fArrayPt;                   //! pt of the tracks
+  std::vector<Double_t>   fArrayEta;                  //! eta of the tracks
+  std::vector<Double_t>   fArrayWeight;               //! weight of the tracks
+  std::vector<Double_t>   fArrayMass;                 //! mass of the tracks
+  std::vector<Int_t>      fArrayCharge;               //! charge of the tracks
+  std::vector<UInt_t>     fArrayPOItype;              //! RP/POI bits (types 0-31) of the tracks
+  std::vector<UInt_t>     fArraySubevent;             //! subevent bits (0-31) of the tracks
+  std::vector<Int_t>      fCachedQHarmonic;           //! harmonic of the cached Q-vectors
+  std::vector<TList*>     fCachedQWeights;            //! weights list of the cached Q-vectors
+  std::vector<Int_t>      fCachedQFlags;              //! weights used and subevent (+1) of the cached Q-vectors
+  std::vector<Double_t>   fCachedQ;                   //! x, y and multiplicity of the cached Q-vectors
  
  private:
   Int_t                   fNumberOfPOItypes;    // how many different flow particle types do we have? (RP,POI,POI_2,...)
   Int_t*                  fNumberOfPOIs;          //[fNumberOfPOItypes] number of tracks that have passed the POI selection
 
-  ClassDef(AliFlowEventSimple,6)
+  ClassDef(AliFlowEventSimple,7)
 };
 
 #endif
@@ -0,0 +1,272 @@
+/*************************************************************************
+* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  * 
+**************************************************************************/
+
+#define ALIFLOWPROFILESTORE_CXX
+
+#include "TCollection.h"
+#include "TList.h"
+#include "TMath.h"
+#include "TProfile.h"
+#include "TString.h"
+#include "AliFlowProfileStore.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// AliFlowProfileStore:
+// Description: compact, mergeable store of 1D profiles
+//              (see the header for the description)
+//////////////////////////////////////////////////////////////////////////////
+
+ClassImp(AliFlowProfileStore)
+
+//-----------------------------------------------------------------------
+AliFlowProfileStore::AliFlowProfileStore():
+TNamed(),
+fNames(),
+fNBins(),
+fUniform(),
+fErrorMode(),
+fSumw2(),
+fBinOffset(),
+fEdgeOffset(),
+fEdges(),
+fBinSumw(),
+fBinSumw2(),
+fBinSumwy(),
+fBinSumwy2(),
+fStats()
+{
+  //default ctor, for io
+  fNames.SetOwner(kTRUE);
+}
+
+//-----------------------------------------------------------------------
+AliFlowProfileStore::AliFlowProfileStore(const char* name, const char* title):
+TNamed(name,title),
+fNames(),
+fNBins(),
+fUniform(),
+fErrorMode(),
+fSumw2(),
+fBinOffset(),
+fEdgeOffset(),
+fEdges(),
+fBinSumw(),
+fBinSumw2(),
+fBinSumwy(),
+fBinSumwy2(),
+fStats()
+{
+  //ctor
+  fNames.SetOwner(kTRUE);
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowProfileStore::BookBins(const char* name, const char* title, Int_t nbins, Option_t* option, Bool_t sumw2)
+{
+  //common part of the booking: name, options and bin arrays of a new profile
+  Int_t id = fNBins.size();
+  TString opt = option;
+  opt.ToLower();
+  EErrorType errorMode = kERRORMEAN;
+  if (opt.Contains("s")) errorMode = kERRORSPREAD;
+  if (opt.Contains("i")) errorMode = kERRORSPREADI;
+  if (opt.Contains("g")) errorMode = kERRORSPREADG;
+
+  fNames.Add(new TNamed(name,title));
+  fNBins.push_back(nbins);
+  fErrorMode.push_back(errorMode);
+  fSumw2.push_back(sumw2 ? 1 : 0);
+  fBinOffset.push_back(fBinSumw.size());
+  fEdgeOffset.push_back(fEdges.size());
+  fBinSumw.resize(fBinSumw.size()+nbins+2,0.);
+  fBinSumw2.resize(fBinSumw2.size()+nbins+2,0.);
+  fBinSumwy.resize(fBinSumwy.size()+nbins+2,0.);
+  fBinSumwy2.resize(fBinSumwy2.size()+nbins+2,0.);
+  fStats.resize(fStats.size()+kNStats,0.);
+  return id;
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowProfileStore::Book(const char* name, const char* title, Int_t nbins, Double_t xmin, Double_t xmax, Option_t* option, Bool_t sumw2)
+{
+  //book a profile with uniform bins
+  Int_t id = BookBins(name,title,nbins,option,sumw2);
+  fUniform.push_back(1);
+  for (Int_t i=0; i<=nbins; i++) fEdges.push_back(xmin+i*(xmax-xmin)/nbins);
+  fEdges[fEdgeOffset[id]+nbins] = xmax;
+  return id;
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowProfileStore::Book(const char* name, const char* title, Int_t nbins, const Double_t* xbins, Option_t* option, Bool_t sumw2)
+{
+  //book a profile with variable bins
+  Int_t id = BookBins(name,title,nbins,option,sumw2);
+  fUniform.push_back(0);
+  for (Int_t i=0; i<=nbins; i++) fEdges.push_back(xbins[i]);
+  return id;
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowProfileStore::FindBin(Int_t id, Double_t x) const
+{
+  //bin of x, same as TAxis::FindBin (0 underflow, nbins+1 overflow)
+  Int_t nbins = fNBins[id];
+  const Double_t* edges = &fEdges[fEdgeOffset[id]];
+  if (x < edges[0]) return 0;
+  if (!(x < edges[nbins])) return nbins+1;
+  if (fUniform[id]) return 1 + Int_t(nbins*(x-edges[0])/(edges[nbins]-edges[0]));
+  return 1 + TMath::BinarySearch(nbins+1,edges,x);
+}
+
+//-----------------------------------------------------------------------
+void AliFlowProfileStore::Fill(Int_t id, Double_t x, Double_t y, Double_t w)
+{
+  //same as TProfile::Fill(x,y,w) for the profile id
+  Int_t bin = FindBin(id,x);
+  Int_t i = fBinOffset[id]+bin;
+  fBinSumw[i]   += w;
+  fBinSumw2[i]  += w*w;
+  fBinSumwy[i]  += w*y;
+  fBinSumwy2[i] += w*y*y;
+  if (w != 1.) fSumw2[id] = 1; // as TProfile, which switches to Sumw2 on the first weighted fill
+
+  Double_t* stats = &fStats[kNStats*id];
+  stats[kEntries]++;
+  if (bin == 0 || bin > fNBins[id]) return; // under/overflows are not in the statistics
+  stats[kSumw]   += w;
+  stats[kSumw2]  += w*w;
+  stats[kSumwx]  += w*x;
+  stats[kSumwx2] += w*x*x;
+  stats[kSumwy]  += w*y;
+  stats[kSumwy2] += w*y*y;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowProfileStore::FillN(Int_t id, Int_t n, const Double_t* x, const Double_t* y, const Double_t* w)
+{
+  //fill n entries of the profile id (unit weights if w is not given)
+  for (Int_t i=0; i<n; i++) Fill(id,x[i],y[i],w ? w[i] : 1.);
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowProfileStore::FindProfile(const char* name) const
+{
+  //id of the profile with the given name, -1 if not booked
+  TObject* named = fNames.FindObject(name);
+  return named ? fNames.IndexOf(named) : -1;
+}
+
+//-----------------------------------------------------------------------
+TProfile* AliFlowProfileStore::MakeProfile(Int_t id) const
+{
+  //TProfile with the content of the profile id, owned by the caller
+  if (id < 0 || id >= GetNProfiles()) return 0x0;
+  static const char* errorOption[] = {"", "s", "i", "g"};
+
+  Int_t nbins = fNBins[id];
+  const Double_t* edges = &fEdges[fEdgeOffset[id]];
+  TProfile* profile = 0x0;
+  if (fUniform[id])
+    profile = new TProfile(fNames.At(id)->GetName(),fNames.At(id)->GetTitle(),nbins,edges[0],edges[nbins],errorOption[fErrorMode[id]]);
+  else
+    profile = new TProfile(fNames.At(id)->GetName(),fNames.At(id)->GetTitle(),nbins,edges,errorOption[fErrorMode[id]]);
+  profile->SetDirectory(0);
+  if (fSumw2[id]) profile->Sumw2();
+
+  Double_t* sumwy = profile->GetArray();
+  TArrayD* sumwy2 = profile->GetSumw2();
+  TArrayD* binSumw2 = profile->GetBinSumw2();
+  for (Int_t bin=0; bin<=nbins+1; bin++)
+  {
+    Int_t i = fBinOffset[id]+bin;
+    sumwy[bin] = fBinSumwy[i];
+    sumwy2->SetAt(fBinSumwy2[i],bin);
+    profile->SetBinEntries(bin,fBinSumw[i]);
+    if (binSumw2->GetSize()) binSumw2->SetAt(fBinSumw2[i],bin);
+  }
+  Double_t stats[kEntries];
+  for (Int_t s=0; s<kEntries; s++) stats[s] = fStats[kNStats*id+s];
+  profile->PutStats(stats);
+  profile->SetEntries(fStats[kNStats*id+kEntries]);
+  return profile;
+}
+
+//-----------------------------------------------------------------------
+Int_t AliFlowProfileStore::MakeProfiles(TList* list) const
+{
+  //add to the list the TProfile of each profile not already in it,
+  //returns the number of profiles added
+  if (!list) return 0;
+  Int_t nAdded = 0;
+  for (Int_t id=0; id<GetNProfiles(); id++)
+  {
+    if (list->FindObject(fNames.At(id)->GetName())) continue;
+    list->Add(MakeProfile(id));
+    nAdded++;
+  }
+  return nAdded;
+}
+
+//-----------------------------------------------------------------------
+Bool_t AliFlowProfileStore::IsCompatible(const AliFlowProfileStore* store) const
+{
+  //same profiles with the same bins
+  return store->fNBins == fNBins && store->fEdges == fEdges;
+}
+
+//-----------------------------------------------------------------------
+Long64_t AliFlowProfileStore::Merge(TCollection* list)
+{
+  //add the content of the stores in the list, which must be booked as this one
+  if (!list) return 0;
+  if (list->IsEmpty()) return (Long64_t) fStats.size();
+
+  TIter next(list);
+  TObject* obj = 0x0;
+  Int_t count = 0;
+  while ((obj = next()))
+  {
+    AliFlowProfileStore* store = dynamic_cast<AliFlowProfileStore*>(obj);
+    if (!store) continue;
+    if (!IsCompatible(store))
+    {
+      Error("Merge","%s: profiles booked differently in %s, not merged",GetName(),store->GetName());
+      continue;
+    }
+    for (UInt_t i=0; i<fBinSumw.size(); i++)
+    {
+      fBinSumw[i]   += store->fBinSumw[i];
+      fBinSumw2[i]  += store->fBinSumw2[i];
+      fBinSumwy[i]  += store->fBinSumwy[i];
+      fBinSumwy2[i] += store->fBinSumwy2[i];
+    }
+    for (UInt_t i=0; i<fStats.size(); i++) fStats[i] += store->fStats[i];
+    for (UInt_t i=0; i<fSumw2.size(); i++) fSumw2[i] |= store->fSumw2[i];
+    count++;
+  }
+  return count+1;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowProfileStore::Reset(Option_t* /*option*/)
+{
+  //clear the content of all the profiles, the booking is kept
+  fBinSumw.assign(fBinSumw.size(),0.);
+  fBinSumw2.assign(fBinSumw2.size(),0.);
+  fBinSumwy.assign(fBinSumwy.size(),0.);
+  fBinSumwy2.assign(fBinSumwy2.size(),0.);
+  fStats.assign(fStats.size(),0.);
+}
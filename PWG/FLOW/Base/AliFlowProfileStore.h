@@ -0,0 +1,78 @@
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/* $Id$ */
+
+#ifndef ALIFLOWPROFILESTORE_H
+#define ALIFLOWPROFILESTORE_H
+
+#include <vector>
+#include "TNamed.h"
+#include "TObjArray.h"
+
+class TCollection;
+class TList;
+class TProfile;
+
+/////////////////////////////////////////////////////////////////////////////
+// Description: compact store for many 1D profiles with the same use as
+//              TProfile (Fill(x,y,w), Sumw2, error option). The sums of
+//              weights, squared weights, w*y and w*y^2 of all the bins of
+//              all the profiles are kept in flat arrays, indexed by the
+//              profile id returned by Book() and by the bin, and the
+//              statistics of each profile in a flat array as well.
+//              Merge() adds the arrays of stores booked in the same way.
+//              MakeProfile()/MakeProfiles() build the equivalent TProfile
+//              objects (same content, errors and statistics as if the
+//              TProfile had been filled) when the results are needed.
+/////////////////////////////////////////////////////////////////////////////
+
+class AliFlowProfileStore : public TNamed {
+ public:
+  AliFlowProfileStore();
+  AliFlowProfileStore(const char* name, const char* title="");
+  virtual ~AliFlowProfileStore() {}
+
+  // book a profile, returns its id (the profiles are numbered in the booking order)
+  Int_t Book(const char* name, const char* title, Int_t nbins, Double_t xmin, Double_t xmax, Option_t* option="", Bool_t sumw2=kTRUE);
+  Int_t Book(const char* name, const char* title, Int_t nbins, const Double_t* xbins, Option_t* option="", Bool_t sumw2=kTRUE);
+
+  void Fill(Int_t id, Double_t x, Double_t y, Double_t w=1.);
+  void FillN(Int_t id, Int_t n, const Double_t* x, const Double_t* y, const Double_t* w=0x0);
+
+  Int_t GetNProfiles() const { return fNBins.size(); }
+  Int_t FindProfile(const char* name) const;
+  TProfile* MakeProfile(Int_t id) const;
+  Int_t MakeProfiles(TList* list) const;
+
+  Long64_t Merge(TCollection* list);
+  virtual void Reset(Option_t* option="");
+
+ private:
+  AliFlowProfileStore(const AliFlowProfileStore& store);
+  AliFlowProfileStore& operator=(const AliFlowProfileStore& store);
+
+  Int_t  BookBins(const char* name, const char* title, Int_t nbins, Option_t* option, Bool_t sumw2);
+  Int_t  FindBin(Int_t id, Double_t x) const;
+  Bool_t IsCompatible(const AliFlowProfileStore* store) const;
+
+  enum { kSumw=0, kSumw2, kSumwx, kSumwx2, kSumwy, kSumwy2, kEntries, kNStats };
+
+  TObjArray             fNames;      // name and title of the profiles
+  std::vector<Int_t>    fNBins;      // number of bins of the profiles
+  std::vector<Int_t>    fUniform;    // 1 if the binning is uniform
+  std::vector<Int_t>    fErrorMode;  // error option of the profiles (EErrorType)
+  std::vector<Int_t>    fSumw2;      // 1 if the sum of squared weights is used for the errors
+  std::vector<Int_t>    fBinOffset;  // offset of the underflow bin of the profiles in the bin arrays
+  std::vector<Int_t>    fEdgeOffset; // offset of the lower edge of the profiles in fEdges
+  std::vector<Double_t> fEdges;      // bin edges, nbins+1 per profile
+  std::vector<Double_t> fBinSumw;    // sum of w per bin (bin entries)
+  std::vector<Double_t> fBinSumw2;   // sum of w^2 per bin
+  std::vector<Double_t> fBinSumwy;   // sum of w*y per bin
+  std::vector<Double_t> fBinSumwy2;  // sum of w*y^2 per bin
+  std::vector<Double_t> fStats;      // kNStats statistics per profile
+
+  ClassDef(AliFlowProfileStore,1)  // compact store of 1D profiles
+};
+
+#endif
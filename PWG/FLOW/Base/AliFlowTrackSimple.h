@@ -121,6 +121,7 @@ public:
 
   const TBits* GetPOItype() const {return &fPOItype;}
   const TBits* GetFlowBits() const {return GetPOItype();}
+  const TBits* GetSubeventBits() const {return &fSubEventBits;}
 
   void  SetID(Int_t i) {fID=i;}
   Int_t GetID() const {return fID;}
@@ -105,6 +105,7 @@ fCalculateEbEFlow(kFALSE),
 fStoreZDCQVecVtxPos(kFALSE),
 fCRC2nEtaBins(6),
 fCalculateFlowQC(kFALSE),
+fUseCompactProfiles(kFALSE),
 fCalculateFlowZDC(kFALSE),
 fCalculateFlowVZ(kFALSE),
 fUseVZERO(kFALSE),
@@ -257,6 +258,7 @@ fCalculateEbEFlow(kFALSE),
 fStoreZDCQVecVtxPos(kFALSE),
 fCRC2nEtaBins(6),
 fCalculateFlowQC(kFALSE),
+fUseCompactProfiles(kFALSE),
 fCalculateFlowZDC(kFALSE),
 fCalculateFlowVZ(kFALSE),
 fUseVZERO(kFALSE),
@@ -385,6 +387,7 @@ void AliAnalysisTaskCRC::UserCreateOutputObjects()
   fQC->SetStoreZDCQVecVtxPos(fStoreZDCQVecVtxPos);
   fQC->SetCRC2nEtaBins(fCRC2nEtaBins);
   fQC->SetCalculateFlowQC(fCalculateFlowQC);
+  fQC->SetUseCompactProfiles(fUseCompactProfiles);
   fQC->SetFlowQCCenBin(fFlowQCCenBin);
   fQC->SetFlowQCDeltaEta(fFlowQCDeltaEta);
   fQC->SetCalculateFlowZDC(fCalculateFlowZDC);
@@ -180,6 +180,8 @@ public:
   Int_t GetCRC2nEtaBins() {return this->fCRC2nEtaBins;};
   void SetCalculateFlowQC(Bool_t const cCRC) {this->fCalculateFlowQC = cCRC;};
   Bool_t GetCalculateFlowQC() const {return this->fCalculateFlowQC;};
+  void SetUseCompactProfiles(Bool_t const cCRC) {this->fUseCompactProfiles = cCRC;};
+  Bool_t GetUseCompactProfiles() const {return this->fUseCompactProfiles;};
   void SetCalculateFlowZDC(Bool_t const cCRC) {this->fCalculateFlowZDC = cCRC;};
   Bool_t GetCalculateFlowZDC() const {return this->fCalculateFlowZDC;};
   void SetCalculateFlowVZ(Bool_t const cCRC) {this->fCalculateFlowVZ = cCRC;};
@@ -320,6 +322,7 @@ private:
   Bool_t fStoreZDCQVecVtxPos;
   Int_t fCRC2nEtaBins; // CRC2 n eta bins
   Bool_t fCalculateFlowQC;
+  Bool_t fUseCompactProfiles;
   Bool_t fCalculateFlowZDC;
   Bool_t fCalculateFlowVZ;
   Bool_t fUseVZERO;
@@ -355,7 +358,7 @@ private:
   Float_t fMaxDevZN;
   Float_t fZDCGainAlpha;
   
-  ClassDef(AliAnalysisTaskCRC, 9);
+  ClassDef(AliAnalysisTaskCRC, 10);
 };
 
 //================================================================================================================
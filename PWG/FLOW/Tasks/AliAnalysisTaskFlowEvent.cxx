@@ -572,6 +572,9 @@ void AliAnalysisTaskFlowEvent::UserExec(Option_t *)
   // associate the mother particles to their daughters in the flow event (if any)
   fFlowEvent->FindDaughters();
 
+  // fill the track arrays once, they are shared by all the flow methods reading this event
+  fFlowEvent->BuildTrackArrays();
+
   //fListHistos->Print();
   //fOutputFile->WriteObject(fFlowEvent,"myFlowEventSimple");
   PostData(1,fFlowEvent);
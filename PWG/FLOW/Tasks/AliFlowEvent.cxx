@@ -1016,12 +1016,13 @@ void AliFlowEvent::Fill( AliFlowTrackCuts* rpCuts,
 //-----------------------------------------------------------------------
 void AliFlowEvent::InsertTrack(AliFlowTrack *track) {
   // adds a flow track at the end of the container
-  AliFlowTrack *pTrack = ReuseTrack( fNumberOfTracks++ );
+  AliFlowTrack *pTrack = ReuseTrack( fNumberOfTracks );
   *pTrack = *track;
   if (track->GetNDaughters()>0)
   {
     fMothersCollection->Add(pTrack);
   }
+  TrackAdded();
   return;
 }
 
@@ -73,6 +73,7 @@
 #include "AliFlowCommonConstants.h"
 #include "AliAnalysisManager.h"
 #include "AliPIDResponse.h"
+#include "AliPIDNSigmaCache.h"
 #include "TF2.h"
 
 
@@ -201,6 +202,7 @@ AliFlowTrackCuts::AliFlowTrackCuts():
   fChi3C(0x0),
   fPIDResponse(NULL),
   fNsigmaCut2(9),
+  fUsePIDCache(kFALSE),
   fPurityFunctionsFile(0),
   fPurityFunctionsList(0),
   fCutITSclusterShared(kFALSE),
@@ -351,6 +353,7 @@ AliFlowTrackCuts::AliFlowTrackCuts(const char* name):
   fChi3C(0x0),
   fPIDResponse(NULL),
   fNsigmaCut2(9),
+  fUsePIDCache(kFALSE),
   fPurityFunctionsFile(0),
   fPurityFunctionsList(0),
   fCutITSclusterShared(kFALSE),
@@ -504,6 +507,7 @@ AliFlowTrackCuts::AliFlowTrackCuts(const AliFlowTrackCuts& that):
   fChi3C(0x0),
   fPIDResponse(that.fPIDResponse),
   fNsigmaCut2(that.fNsigmaCut2),
+  fUsePIDCache(that.fUsePIDCache),
   fPurityFunctionsFile(that.fPurityFunctionsFile),
   fPurityFunctionsList(that.fPurityFunctionsList),
   fCutITSclusterShared(kFALSE),
@@ -699,6 +703,7 @@ AliFlowTrackCuts& AliFlowTrackCuts::operator=(const AliFlowTrackCuts& that)
 
   fPIDResponse = that.fPIDResponse;
   fNsigmaCut2 = that.fNsigmaCut2;
+  fUsePIDCache = that.fUsePIDCache;
  
   fRun = that.fRun;
   
@@ -3930,6 +3935,15 @@ Bool_t AliFlowTrackCuts::PassesNucleiSelection(const AliESDtrack* track)
 }
 // end part added by Natasha
 //-----------------------------------------------------------------------
+Float_t AliFlowTrackCuts::NumberOfSigmas(Int_t det, const AliVTrack* track) const
+{
+    // n sigma of the track for fParticleID in the given detector,
+    // from the event-scoped cache shared with the other tasks if requested
+    if(fUsePIDCache)
+        return AliPIDNSigmaCache::Instance()->NumberOfSigmas(fPIDResponse,fEvent,(AliPIDResponse::EDetector)det,track,fParticleID);
+    return fPIDResponse->NumberOfSigmas((AliPIDResponse::EDetector)det,track,fParticleID);
+}
+//-----------------------------------------------------------------------
 Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaCut(const AliAODTrack* track) 
 {
     // do a simple combined cut on the n sigma from tpc and tof
@@ -3945,8 +3959,8 @@ Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaCut(const AliAODTrack* track)
     // check TPC status
     if(track->GetTPCsignal() < 10) return kFALSE;
 
-    Float_t nsigmaTPC = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,track,fParticleID);
-    Float_t nsigmaTOF = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,track,fParticleID);
+    Float_t nsigmaTPC = NumberOfSigmas(AliPIDResponse::kTPC,track);
+    Float_t nsigmaTOF = NumberOfSigmas(AliPIDResponse::kTOF,track);
 
     Float_t nsigma2 = nsigmaTPC*nsigmaTPC + nsigmaTOF*nsigmaTOF;
 
@@ -3969,8 +3983,8 @@ Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaCut(const AliESDtrack* track)
     // check TPC status
     if(track->GetTPCsignal() < 10) return kFALSE;
 
-    Float_t nsigmaTPC = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,track,fParticleID);
-    Float_t nsigmaTOF = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,track,fParticleID);
+    Float_t nsigmaTPC = NumberOfSigmas(AliPIDResponse::kTPC,track);
+    Float_t nsigmaTOF = NumberOfSigmas(AliPIDResponse::kTOF,track);
 
     Float_t nsigma2 = nsigmaTPC*nsigmaTPC + nsigmaTOF*nsigmaTOF;
 
@@ -3999,8 +4013,8 @@ Bool_t AliFlowTrackCuts::PassesTPCTOFNsigmaPurityCut(const AliAODTrack* track)
      Double_t LowPtPIDTPCnsigHigh_Kaon[2] ={3,2.2};
      */
     
-    Float_t nsigmaTPC = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,track,fParticleID);
-    Float_t nsigmaTOF = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,track,fParticleID);
+    Float_t nsigmaTPC = NumberOfSigmas(AliPIDResponse::kTPC,track);
+    Float_t nsigmaTOF = NumberOfSigmas(AliPIDResponse::kTOF,track);
     
     int index = (fParticleID-2)*60 + p_int;
     if ( (track->IsOn(AliAODTrack::kITSin))){
@@ -5166,7 +5180,7 @@ Bool_t AliFlowTrackCuts::PassesTPCTPCTOFNsigmaCut(const AliAODTrack* track){
   }
   if(pass){
     Double_t Pt = track->Pt();
-    Float_t nsigmaTPC = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,track,fParticleID);
+    Float_t nsigmaTPC = NumberOfSigmas(AliPIDResponse::kTPC,track);
     Float_t nsigma2 = 999.;
     if(Pt < fPtTOFPIDoff){
       nsigma2 = nsigmaTPC*nsigmaTPC;
@@ -5175,7 +5189,7 @@ Bool_t AliFlowTrackCuts::PassesTPCTPCTOFNsigmaCut(const AliAODTrack* track){
       if (((track->GetStatus()&AliVTrack::kTOFout)==0)&&((track->GetStatus()&AliVTrack::kTIME)==0)){
         pass = kFALSE;
       }else{
-        Float_t nsigmaTOF = fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,track,fParticleID);
+        Float_t nsigmaTOF = NumberOfSigmas(AliPIDResponse::kTOF,track);
         nsigma2 = nsigmaTPC*nsigmaTPC + nsigmaTOF*nsigmaTOF;
       }
     }
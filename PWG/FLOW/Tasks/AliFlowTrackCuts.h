@@ -346,6 +346,8 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
 
   void SetNumberOfSigmas(Float_t val) {fNsigmaCut2 = val*val;};
   Float_t GetNumberOfSigmas() const {return TMath::Sqrt(fNsigmaCut2);};
+  void SetUsePIDCache(Bool_t b=kTRUE) {fUsePIDCache = b;};
+  Bool_t GetUsePIDCache() const {return fUsePIDCache;};
  
   void SetRun(Int_t const run) {this->fRun = run;};
   Int_t GetRun() const {return this->fRun;};
@@ -376,6 +378,7 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   Bool_t TPCTOFagree(const AliVTrack *track);
   // end part added by F. Noferini
   Bool_t PassesTPCTPCTOFNsigmaCut(const AliAODTrack* track); // added by B. Hohlweger
+  Float_t NumberOfSigmas(Int_t det, const AliVTrack* track) const; // nsigma of fParticleID, from the PID response or the cache
 
   //the cuts
   AliESDtrackCuts* fAliESDtrackCuts; //alianalysis cuts
@@ -514,6 +517,7 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
 
   AliPIDResponse *fPIDResponse;            //! Pid reponse to manage Nsigma cuts
   Float_t fNsigmaCut2;                     // Number of sigma^2 (cut value) for TPC+TOF nsigma cut
+  Bool_t fUsePIDCache;                     // take the TPC/TOF nsigma from the event-scoped AliPIDNSigmaCache
     
   //TPC TOF nsigma Purity based cut functions
   TFile                 *fPurityFunctionsFile;       //! purity functions file
@@ -527,7 +531,7 @@ class AliFlowTrackCuts : public AliFlowTrackSimpleCuts {
   Double_t  fMaxITSChi2;                // fMaxITSChi2
   Int_t         fRun;                   // run number
   
-  ClassDef(AliFlowTrackCuts,20)
+  ClassDef(AliFlowTrackCuts,21)
 };
 
 #endif
@@ -61,6 +61,12 @@ AliEmcalJet::AliEmcalJet() :
   fLabel(-1),
   fHasGhost(kFALSE),
   fGhosts(),
+  fConstPt(),
+  fConstEta(),
+  fConstPhi(),
+  fConstM(),
+  fConstType(),
+  fConstIndex(),
   fJetShapeProperties(0),
   fJetAcceptanceType(0)
 {
@@ -111,6 +117,12 @@ AliEmcalJet::AliEmcalJet(Double_t px, Double_t py, Double_t pz) :
   fLabel(-1),
   fHasGhost(kFALSE),
   fGhosts(),
+  fConstPt(),
+  fConstEta(),
+  fConstPhi(),
+  fConstM(),
+  fConstType(),
+  fConstIndex(),
   fJetShapeProperties(0),
   fJetAcceptanceType(0)
 {
@@ -166,6 +178,12 @@ AliEmcalJet::AliEmcalJet(Double_t pt, Double_t eta, Double_t phi, Double_t m) :
   fLabel(-1),
   fHasGhost(kFALSE),
   fGhosts(),
+  fConstPt(),
+  fConstEta(),
+  fConstPhi(),
+  fConstM(),
+  fConstType(),
+  fConstIndex(),
   fJetShapeProperties(0),
   fJetAcceptanceType(0)
 {
@@ -215,6 +233,12 @@ AliEmcalJet::AliEmcalJet(const AliEmcalJet& jet) :
   fLabel(jet.fLabel),
   fHasGhost(jet.fHasGhost),
   fGhosts(jet.fGhosts),
+  fConstPt(jet.fConstPt),
+  fConstEta(jet.fConstEta),
+  fConstPhi(jet.fConstPhi),
+  fConstM(jet.fConstM),
+  fConstType(jet.fConstType),
+  fConstIndex(jet.fConstIndex),
   fJetShapeProperties(0),
   fJetAcceptanceType(jet.fJetAcceptanceType)
 {
@@ -281,6 +305,12 @@ AliEmcalJet& AliEmcalJet::operator=(const AliEmcalJet& jet)
     fLabel              = jet.fLabel;
     fHasGhost = jet.fHasGhost;
     fGhosts   = jet.fGhosts;
+    fConstPt    = jet.fConstPt;
+    fConstEta   = jet.fConstEta;
+    fConstPhi   = jet.fConstPhi;
+    fConstM     = jet.fConstM;
+    fConstType  = jet.fConstType;
+    fConstIndex = jet.fConstIndex;
     if (jet.fJetShapeProperties) {
       fJetShapeProperties = new AliEmcalJetShapeProperties(*(jet.fJetShapeProperties));
     }
@@ -374,14 +404,112 @@ TLorentzVector AliEmcalJet::SubtractRhoVect(Double_t rho, Bool_t save)
 
 /**
  *  Sort constituent by index (increasing).
- *
+ *  If the constituent kinematics block is filled, its positions are updated
+ *  accordingly and the block is sorted by decreasing pt.
  */
 void AliEmcalJet::SortConstituents()
 {
+  if (HasConstituentKinematics()) {
+    SortConstituentIDs(fClusterIDs, kClusterConstituent);
+    SortConstituentIDs(fTrackIDs, kTrackConstituent);
+    SortConstituentKinematics();
+    return;
+  }
+
   std::sort(fClusterIDs.GetArray(), fClusterIDs.GetArray() + fClusterIDs.GetSize());
   std::sort(fTrackIDs.GetArray(), fTrackIDs.GetArray() + fTrackIDs.GetSize());
 }
 
+/**
+ * Sort an array of constituent ids (increasing) and move the positions
+ * of the corresponding entries of the constituent kinematics block.
+ * @param ids Array of constituent ids (fTrackIDs or fClusterIDs)
+ * @param type Type of the constituents in the array
+ */
+void AliEmcalJet::SortConstituentIDs(TArrayI& ids, Int_t type)
+{
+  Int_t n = ids.GetSize();
+  std::vector<std::pair<Int_t, Int_t> > order(n);
+  for (Int_t i = 0; i < n; i++) order[i] = std::make_pair(ids[i], i);
+  std::sort(order.begin(), order.end());
+
+  std::vector<Int_t> newPos(n);
+  for (Int_t i = 0; i < n; i++) {
+    ids[i] = order[i].first;
+    newPos[order[i].second] = i;
+  }
+
+  for (UInt_t i = 0; i < fConstIndex.size(); i++) {
+    if (fConstType[i] != type || fConstIndex[i] < 0 || fConstIndex[i] >= n) continue;
+    fConstIndex[i] = newPos[fConstIndex[i]];
+  }
+}
+
+/**
+ * Sort the constituent kinematics block by decreasing pt
+ * (constituents with the same pt keep their order).
+ */
+void AliEmcalJet::SortConstituentKinematics()
+{
+  Int_t n = fConstPt.size();
+  std::vector<std::pair<Double_t, Int_t> > order(n);
+  for (Int_t i = 0; i < n; i++) order[i] = std::make_pair(fConstPt[i], i);
+  std::stable_sort(order.begin(), order.end(), sort_descend());
+
+  std::vector<Float_t> pt(n), eta(n), phi(n), m(n);
+  std::vector<Char_t> type(n);
+  std::vector<Int_t> index(n);
+  for (Int_t i = 0; i < n; i++) {
+    Int_t j = order[i].second;
+    pt[i]    = fConstPt[j];
+    eta[i]   = fConstEta[j];
+    phi[i]   = fConstPhi[j];
+    m[i]     = fConstM[j];
+    type[i]  = fConstType[j];
+    index[i] = fConstIndex[j];
+  }
+  fConstPt.swap(pt);
+  fConstEta.swap(eta);
+  fConstPhi.swap(phi);
+  fConstM.swap(m);
+  fConstType.swap(type);
+  fConstIndex.swap(index);
+}
+
+/**
+ * Add a constituent to the constituent kinematics block.
+ * This function should be called by the jet finder together with AddTrackAt/AddClusterAt;
+ * the block is sorted by decreasing pt by SortConstituents().
+ * @param type Type of the constituent (EConstituentType)
+ * @param idx Position of the constituent in fTrackIDs or fClusterIDs
+ * @param pt Transverse momentum of the constituent
+ * @param eta Pseudo-rapidity of the constituent
+ * @param phi Azimuthal angle of the constituent
+ * @param m Mass of the constituent
+ */
+void AliEmcalJet::AddConstituentKinematics(Int_t type, Int_t idx, Double_t pt, Double_t eta, Double_t phi, Double_t m)
+{
+  fConstPt.push_back(pt);
+  fConstEta.push_back(eta);
+  fConstPhi.push_back(TVector2::Phi_0_2pi(phi));
+  fConstM.push_back(m);
+  fConstType.push_back(type);
+  fConstIndex.push_back(idx);
+}
+
+/**
+ * Remove all the entries of the constituent kinematics block.
+ */
+void AliEmcalJet::ClearConstituentKinematics()
+{
+  fConstPt.clear();
+  fConstEta.clear();
+  fConstPhi.clear();
+  fConstM.clear();
+  fConstType.clear();
+  fConstIndex.clear();
+}
+
 /**
  * Helper function to calculate the distance between two jets or a jet and a particle
  * @param part Constant pointer to another particle
@@ -437,6 +565,24 @@ std::vector<int> AliEmcalJet::GetPtSortedTrackConstituentIndexes(TClonesArray* t
   return index_sorted_list;
 }
 
+/**
+ * Indexes of the track constituents sorted by decreasing pT, read from the
+ * constituent kinematics block (no access to the tracks and no sorting).
+ * The pT is the one stored by the jet finder (in single precision); if the block
+ * is not filled the returned vector is empty and the version taking the track array
+ * should be used.
+ * @return Standard vector with the list of constituent indexes (relative to fTrackIDs)
+ */
+std::vector<int> AliEmcalJet::GetPtSortedTrackConstituentIndexes() const
+{
+  std::vector<int> index_sorted_list;
+  index_sorted_list.reserve(GetNumberOfTracks());
+  for (UInt_t i = 0; i < fConstIndex.size(); i++) {
+    if (fConstType[i] == kTrackConstituent) index_sorted_list.push_back(fConstIndex[i]);
+  }
+  return index_sorted_list;
+}
+
 /**
  * Get the momentum fraction of a jet constituent
  * @param trkPx First transverse component of the momentum of the jet constituent
@@ -670,6 +816,7 @@ void AliEmcalJet::Clear(Option_t */*option*/)
   fPtSub = 0;
   fGhosts.clear();
   fHasGhost = kFALSE;
+  ClearConstituentKinematics();
 }
 
 /**
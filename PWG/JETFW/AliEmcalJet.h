@@ -84,6 +84,15 @@ class AliEmcalJet : public AliVParticle
     kBckgrd3 = 1<<6     ///< Generic background 3
   };
 
+  /**
+   * @enum EConstituentType
+   * @brief Type of the entries of the constituent kinematics block
+   */
+  enum EConstituentType {
+    kTrackConstituent   = 0,  ///< Track (particle) constituent, index relative to fTrackIDs
+    kClusterConstituent = 1   ///< Cluster constituent, index relative to fClusterIDs
+  };
+
   AliEmcalJet();
   AliEmcalJet(Double_t px, Double_t py, Double_t pz);
   AliEmcalJet(Double_t pt, Double_t eta, Double_t phi, Double_t m);
@@ -169,6 +178,24 @@ class AliEmcalJet : public AliVParticle
   Int_t             ContainsTrack(Int_t it)                                        const;
   AliVParticle     *GetLeadingTrack(TClonesArray *tracks)                          const;
 
+  // Constituent kinematics block (filled by the jet finder on request, sorted by decreasing pt)
+  void              AddConstituentKinematics(Int_t type, Int_t idx, Double_t pt, Double_t eta, Double_t phi, Double_t m);
+  void              ClearConstituentKinematics();
+  Bool_t            HasConstituentKinematics()                const { return !fConstPt.empty()                          ; }
+  Int_t             GetNumberOfConstituentKinematics()        const { return fConstPt.size()                            ; }
+  Float_t           ConstituentPt(Int_t i)                    const { return fConstPt[i]                                ; }
+  Float_t           ConstituentEta(Int_t i)                   const { return fConstEta[i]                               ; }
+  Float_t           ConstituentPhi(Int_t i)                   const { return fConstPhi[i]                               ; }
+  Float_t           ConstituentM(Int_t i)                     const { return fConstM[i]                                 ; }
+  Int_t             ConstituentType(Int_t i)                  const { return fConstType[i]                              ; }
+  Int_t             ConstituentIndex(Int_t i)                 const { return fConstIndex[i]                             ; }
+  const Float_t    *GetConstituentPtArray()                   const { return fConstPt.empty()  ? 0 : &fConstPt[0]       ; }
+  const Float_t    *GetConstituentEtaArray()                  const { return fConstEta.empty() ? 0 : &fConstEta[0]      ; }
+  const Float_t    *GetConstituentPhiArray()                  const { return fConstPhi.empty() ? 0 : &fConstPhi[0]      ; }
+  const Float_t    *GetConstituentMArray()                    const { return fConstM.empty()   ? 0 : &fConstM[0]        ; }
+  const Char_t     *GetConstituentTypeArray()                 const { return fConstType.empty() ? 0 : &fConstType[0]    ; }
+  const Int_t      *GetConstituentIndexArray()                const { return fConstIndex.empty() ? 0 : &fConstIndex[0]  ; }
+
   // Fragmentation function
   Double_t          GetZ(const Double_t trkPx, const Double_t trkPy, const Double_t trkPz)  const;
   Double_t          GetZ(const AliVParticle* trk )                                          const;
@@ -206,6 +233,7 @@ class AliEmcalJet : public AliVParticle
   // Sorting methods
   void              SortConstituents();
   std::vector<int>  GetPtSortedTrackConstituentIndexes(TClonesArray *tracks) const;
+  std::vector<int>  GetPtSortedTrackConstituentIndexes() const;
 
   // Trigger
   Bool_t            IsTriggerJet(UInt_t trigger=AliVEvent::kEMCEJE) const   { return (Bool_t)((fTriggers & trigger) != 0); }
@@ -234,7 +262,7 @@ class AliEmcalJet : public AliVParticle
   // Ghosts
   void AddGhost(const Double_t dPx, const Double_t dPy, const Double_t dPz, const Double_t dE);
   Bool_t HasGhost() const                               { return fHasGhost; }
-  const std::vector<TLorentzVector> GetGhosts()   const { return fGhosts  ; }
+  const std::vector<TLorentzVector>& GetGhosts()  const { return fGhosts  ; }
 
   // Debug printouts
   void Print(Option_t* /*opt*/ = "") const;
@@ -310,6 +338,13 @@ class AliEmcalJet : public AliVParticle
   Bool_t            fHasGhost;            //!<! Whether ghost particle are included within the constituents
   std::vector<TLorentzVector> fGhosts;    //!<! Vector containing the ghost particles
 
+  std::vector<Float_t> fConstPt;          //!<! Transverse momentum of the constituents (sorted by decreasing pt)
+  std::vector<Float_t> fConstEta;         //!<! Pseudo-rapidity of the constituents
+  std::vector<Float_t> fConstPhi;         //!<! Azimuthal angle of the constituents (0, 2pi)
+  std::vector<Float_t> fConstM;           //!<! Mass of the constituents
+  std::vector<Char_t>  fConstType;        //!<! Type of the constituents (EConstituentType)
+  std::vector<Int_t>   fConstIndex;       //!<! Position of the constituents in fTrackIDs/fClusterIDs
+
   AliEmcalJetShapeProperties *fJetShapeProperties; //!<! Pointer to the jet shape properties
   UInt_t fJetAcceptanceType;    //!<!  Jet acceptance type (stored bitwise)
 
@@ -323,8 +358,11 @@ class AliEmcalJet : public AliVParticle
     bool operator () (const std::pair<Double_t, Int_t>& p1, const std::pair<Double_t, Int_t>& p2)  { return p1.first > p2.first ; }
   };
 
+  void              SortConstituentIDs(TArrayI& ids, Int_t type);
+  void              SortConstituentKinematics();
+
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJet,19);
+  ClassDef(AliEmcalJet,20);
   /// \endcond
 };
 
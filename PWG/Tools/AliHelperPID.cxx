@@ -32,6 +32,7 @@
 #include "AliAODMCParticle.h" 
 #include "AliPIDResponse.h"   
 #include "AliPIDCombined.h"   
+#include "AliPIDNSigmaCache.h"
 #include "AliAnalysisManager.h"
 #include "AliInputEventHandler.h"
 
@@ -44,7 +45,7 @@ const char * kParticleSpeciesName[]={"Pions","Kaons","Protons","Undefined"} ;
 
 ClassImp(AliHelperPID)
 
-AliHelperPID::AliHelperPID() : TNamed("HelperPID", "PID object"),fisMC(0), fPIDType(kNSigmaTPCTOF), fNSigmaPID(3), fBayesCut(0.8), fPIDResponse(0x0), fPIDCombined(0x0),fOutputList(0x0),fRequestTOFPID(1),fRemoveTracksT0Fill(0),fUseExclusiveNSigma(0),fPtTOFPID(.6),fHasTOFPID(0){
+AliHelperPID::AliHelperPID() : TNamed("HelperPID", "PID object"),fisMC(0), fPIDType(kNSigmaTPCTOF), fNSigmaPID(3), fBayesCut(0.8), fPIDResponse(0x0), fPIDCombined(0x0),fOutputList(0x0),fRequestTOFPID(1),fRemoveTracksT0Fill(0),fUseExclusiveNSigma(0),fPtTOFPID(.6),fHasTOFPID(0),fUsePIDCache(0){
 
   // Fixing Leaks 
   Bool_t oldStatus = TH1::AddDirectoryStatus();
@@ -309,15 +310,23 @@ UInt_t AliHelperPID::CalcPIDCombined(const AliVTrack *track,const AliPIDResponse
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
 
+Double_t AliHelperPID::NumberOfSigmas(Int_t det, AliVTrack * trk, Int_t type) const{
+  //nsigma of the track, from the event-scoped cache if requested
+  if(fUsePIDCache) return AliPIDNSigmaCache::Instance()->NumberOfSigmas(fPIDResponse, (AliPIDResponse::EDetector)det, trk, (AliPID::EParticleType)type);
+  if(det==AliPIDResponse::kTOF) return fPIDResponse->NumberOfSigmasTOF(trk, (AliPID::EParticleType)type);
+  return fPIDResponse->NumberOfSigmasTPC(trk, (AliPID::EParticleType)type);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
 void AliHelperPID::CalculateNSigmas(AliVTrack * trk, Bool_t FIllQAHistos){ 
   //defines data member fnsigmas
   
   // Compute nsigma for each hypthesis
-  AliVParticle *inEvHMain = dynamic_cast<AliVParticle *>(trk);
   // --- TPC
-  Double_t nsigmaTPCkProton = fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kProton);
-  Double_t nsigmaTPCkKaon   = fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kKaon); 
-  Double_t nsigmaTPCkPion   = fPIDResponse->NumberOfSigmasTPC(inEvHMain, AliPID::kPion); 
+  Double_t nsigmaTPCkProton = NumberOfSigmas(AliPIDResponse::kTPC, trk, AliPID::kProton);
+  Double_t nsigmaTPCkKaon   = NumberOfSigmas(AliPIDResponse::kTPC, trk, AliPID::kKaon); 
+  Double_t nsigmaTPCkPion   = NumberOfSigmas(AliPIDResponse::kTPC, trk, AliPID::kPion); 
   // --- TOF
   Double_t nsigmaTOFkProton=999.,nsigmaTOFkKaon=999.,nsigmaTOFkPion=999.;
   Double_t nsigmaTPCTOFkProton=999.,nsigmaTPCTOFkKaon=999.,nsigmaTPCTOFkPion=999.;
@@ -325,9 +334,9 @@ void AliHelperPID::CalculateNSigmas(AliVTrack * trk, Bool_t FIllQAHistos){
   CheckTOF(trk);
   
   if(fHasTOFPID && trk->Pt()>fPtTOFPID){//use TOF information
-    nsigmaTOFkProton = fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kProton);
-    nsigmaTOFkKaon   = fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kKaon); 
-    nsigmaTOFkPion   = fPIDResponse->NumberOfSigmasTOF(inEvHMain, AliPID::kPion); 
+    nsigmaTOFkProton = NumberOfSigmas(AliPIDResponse::kTOF, trk, AliPID::kProton);
+    nsigmaTOFkKaon   = NumberOfSigmas(AliPIDResponse::kTOF, trk, AliPID::kKaon); 
+    nsigmaTOFkPion   = NumberOfSigmas(AliPIDResponse::kTOF, trk, AliPID::kPion); 
     Double_t d2Proton=nsigmaTPCkProton * nsigmaTPCkProton + nsigmaTOFkProton * nsigmaTOFkProton;
     Double_t d2Kaon=nsigmaTPCkKaon * nsigmaTPCkKaon + nsigmaTOFkKaon * nsigmaTOFkKaon;
     Double_t d2Pion=nsigmaTPCkPion * nsigmaTPCkPion + nsigmaTOFkPion * nsigmaTOFkPion;
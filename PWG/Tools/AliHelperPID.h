@@ -90,6 +90,9 @@ class AliHelperPID : public TNamed
   //set cut on beyesian probability
   void SetBayesCut(Double_t cut){fBayesCut=cut;}
   Double_t GetBayesCut(){return fBayesCut;}
+  //serve the nsigma from the event-scoped AliPIDNSigmaCache shared with the other wagons
+  void SetUsePIDCache(Bool_t use=kTRUE){fUsePIDCache=use;}
+  Bool_t GetUsePIDCache(){return fUsePIDCache;}
   
   //getters of the other data members
   TList * GetOutputList() {return fOutputList;}//get the TList with histos
@@ -131,11 +134,14 @@ class AliHelperPID : public TNamed
   Bool_t fUseExclusiveNSigma;//if true returns the identity only if no double counting
   Double_t fPtTOFPID; //lower pt bound for the TOF pid
   Bool_t fHasTOFPID;
+  Bool_t fUsePIDCache; // nsigma from AliPIDNSigmaCache
+  
+  Double_t NumberOfSigmas(Int_t det, AliVTrack * trk, Int_t type) const;//TPC or TOF nsigma from the PID response or from the cache
   
   AliHelperPID(const AliHelperPID&);
   AliHelperPID& operator=(const AliHelperPID&);
   
-  ClassDef(AliHelperPID, 8);
+  ClassDef(AliHelperPID, 9);
   
 };
 #endif
@@ -0,0 +1,245 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//
+// Event-scoped cache of the PID response n-sigma
+// (see the header for the description)
+//
+
+#include <algorithm>
+
+#include <TString.h>
+
+#include "AliVEvent.h"
+#include "AliVParticle.h"
+#include "AliVTrack.h"
+#include "AliESDtrack.h"
+#include "AliAODTrack.h"
+
+#include "AliPIDNSigmaCache.h"
+
+ClassImp(AliPIDNSigmaCache)
+
+AliPIDNSigmaCache* AliPIDNSigmaCache::fgInstance = 0x0;
+
+namespace {
+  // marks the values not computed yet (NumberOfSigmas never returns it)
+  const Float_t kNotComputed = -1.e30;
+
+  // orders track indices by the address of the track
+  struct AddressOrder {
+    AddressOrder(const std::vector<const AliVParticle*>& tracks) : fTracks(tracks) {}
+    Bool_t operator()(Int_t i, Int_t j) const { return fTracks[i] < fTracks[j]; }
+    Bool_t operator()(Int_t i, const AliVParticle* p) const { return fTracks[i] < p; }
+    const std::vector<const AliVParticle*>& fTracks;
+  };
+}
+
+//________________________________________________________________________
+AliPIDNSigmaCache::AliPIDNSigmaCache() :
+  TObject(),
+  fEvent(0x0),
+  fPIDResponse(0x0),
+  fRunNumber(-1),
+  fPeriodNumber(0),
+  fOrbitNumber(0),
+  fBunchCrossNumber(0),
+  fNTracks(0),
+  fFirstPt(0),
+  fLastPt(0),
+  fTracks(),
+  fSorted(),
+  fNSigma(),
+  fConfig(),
+  fConfigNow(),
+  fNComputed(0),
+  fNServed(0)
+{
+  // constructor
+  Reset();
+}
+
+//________________________________________________________________________
+AliPIDNSigmaCache* AliPIDNSigmaCache::Instance()
+{
+  // instance shared by all the users in the process
+  if (!fgInstance)
+    fgInstance = new AliPIDNSigmaCache;
+  return fgInstance;
+}
+
+//________________________________________________________________________
+void AliPIDNSigmaCache::Reset()
+{
+  // forget the cached event
+  fEvent = 0x0;
+  fPIDResponse = 0x0;
+  fNTracks = 0;
+  fTracks.clear();
+  fSorted.clear();
+  fNSigma.clear();
+  fConfig.clear();
+  for (Int_t det = 0; det < AliPIDResponse::kNdetectors; det++)
+    for (Int_t type = 0; type < AliPID::kSPECIESC; type++)
+      fBlock[det][type] = -1;
+}
+
+//________________________________________________________________________
+const AliVEvent* AliPIDNSigmaCache::GetEventOfTrack(const AliVTrack* track)
+{
+  // event the track belongs to
+  if (const AliESDtrack* esdTrack = dynamic_cast<const AliESDtrack*>(track))
+    return esdTrack->GetESDEvent();
+  if (const AliAODTrack* aodTrack = dynamic_cast<const AliAODTrack*>(track))
+    return aodTrack->GetAODEvent();
+  return 0x0;
+}
+
+//________________________________________________________________________
+Float_t AliPIDNSigmaCache::NumberOfSigmas(const AliPIDResponse* pid, const AliVEvent* event, AliPIDResponse::EDetector det,
+                                          const AliVTrack* track, AliPID::EParticleType type)
+{
+  // n-sigma of the track for the given detector and species, from the cache when possible
+
+  if (!event)
+    event = GetEventOfTrack(track);
+  if (!event || det < 0 || det >= AliPIDResponse::kNdetectors || type < 0 || type >= AliPID::kSPECIESC) {
+    fNComputed++;
+    return pid->NumberOfSigmas(det, track, type);
+  }
+
+  if (!IsCurrent(event, pid))
+    SetCurrent(event, pid);
+
+  Int_t i = FindTrack(track);
+  if (i < 0) {
+    fNComputed++;
+    return pid->NumberOfSigmas(det, track, type);
+  }
+
+  if (fBlock[det][type] < 0)
+    AddBlock(det, type);
+  Float_t& nsigma = fNSigma[fBlock[det][type] + i];
+  if (nsigma == kNotComputed) {
+    nsigma = pid->NumberOfSigmas(det, track, type);
+    fNComputed++;
+  } else {
+    fNServed++;
+  }
+  return nsigma;
+}
+
+//________________________________________________________________________
+Bool_t AliPIDNSigmaCache::IsCurrent(const AliVEvent* event, const AliPIDResponse* pid)
+{
+  // true if the cached values belong to this event and PID response configuration
+
+  if (event != fEvent || pid != fPIDResponse)
+    return kFALSE;
+  if (event->GetNumberOfTracks() != fNTracks || event->GetRunNumber() != fRunNumber)
+    return kFALSE;
+  if (event->GetPeriodNumber() != fPeriodNumber || event->GetOrbitNumber() != fOrbitNumber
+      || event->GetBunchCrossNumber() != fBunchCrossNumber)
+    return kFALSE;
+  if (fNTracks > 0) {
+    const AliVParticle* first = event->GetTrack(0);
+    const AliVParticle* last = event->GetTrack(fNTracks - 1);
+    if (first != fTracks[0] || last != fTracks[fNTracks - 1]
+        || !first || first->Pt() != fFirstPt || !last || last->Pt() != fLastPt)
+      return kFALSE;
+  }
+
+  GetConfiguration(pid, fConfigNow);
+  return fConfigNow == fConfig;
+}
+
+//________________________________________________________________________
+void AliPIDNSigmaCache::GetConfiguration(const AliPIDResponse* pid, std::vector<Float_t>& config) const
+{
+  // settings of the PID response which the n-sigma depends on
+
+  config.clear();
+  config.push_back(pid->UseTPCEtaCorrection());
+  config.push_back(pid->UseTPCMultiplicityCorrection());
+  config.push_back(pid->IsTunedOnData());
+  config.push_back(pid->GetTunedOnDataMask());
+  const AliTOFPIDResponse& tof = pid->GetTOFResponse();
+  for (Int_t i = 0; i < tof.GetNmomBins(); i++) {
+    config.push_back(tof.GetT0bin(i));
+    config.push_back(tof.GetT0binRes(i));
+    config.push_back(tof.GetT0binMask(i));
+  }
+}
+
+//________________________________________________________________________
+void AliPIDNSigmaCache::SetCurrent(const AliVEvent* event, const AliPIDResponse* pid)
+{
+  // start caching a new event
+
+  Reset();
+  fEvent = event;
+  fPIDResponse = pid;
+  fRunNumber = event->GetRunNumber();
+  fPeriodNumber = event->GetPeriodNumber();
+  fOrbitNumber = event->GetOrbitNumber();
+  fBunchCrossNumber = event->GetBunchCrossNumber();
+  fNTracks = event->GetNumberOfTracks();
+  GetConfiguration(pid, fConfig);
+
+  fTracks.resize(fNTracks);
+  fSorted.resize(fNTracks);
+  for (Int_t i = 0; i < fNTracks; i++) {
+    fTracks[i] = event->GetTrack(i);
+    fSorted[i] = i;
+  }
+  std::sort(fSorted.begin(), fSorted.end(), AddressOrder(fTracks));
+
+  if (fNTracks > 0) {
+    fFirstPt = fTracks[0] ? fTracks[0]->Pt() : 0;
+    fLastPt = fTracks[fNTracks - 1] ? fTracks[fNTracks - 1]->Pt() : 0;
+  }
+}
+
+//________________________________________________________________________
+Int_t AliPIDNSigmaCache::FindTrack(const AliVParticle* track) const
+{
+  // position of the track in the event, -1 if it is not one of the event tracks
+
+  if (!track)
+    return -1;
+  std::vector<Int_t>::const_iterator it = std::lower_bound(fSorted.begin(), fSorted.end(), track, AddressOrder(fTracks));
+  if (it == fSorted.end() || fTracks[*it] != track)
+    return -1;
+  return *it;
+}
+
+//________________________________________________________________________
+void AliPIDNSigmaCache::AddBlock(Int_t det, Int_t type)
+{
+  // values of one detector and species for all the tracks of the event,
+  // computed at their first request
+
+  Int_t offset = fNSigma.size();
+  fNSigma.resize(offset + fNTracks, kNotComputed);
+  fBlock[det][type] = offset;
+}
+
+//________________________________________________________________________
+void AliPIDNSigmaCache::Print(Option_t* /*option*/) const
+{
+  // number of values computed with the PID response and served from the cache
+
+  Printf("AliPIDNSigmaCache: %lld n-sigma computed, %lld served from the cache", fNComputed, fNServed);
+}
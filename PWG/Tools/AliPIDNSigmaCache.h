@@ -0,0 +1,98 @@
+#ifndef ALIPIDNSIGMACACHE_H
+#define ALIPIDNSIGMACACHE_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//
+// Event-scoped cache of the PID response n-sigma, shared by all the users
+// (helpers, cuts objects) of the process through Instance().
+//
+// The values are the ones of AliPIDResponse::NumberOfSigmas. Each value is
+// computed at its first request in the event and kept in one array per
+// (detector, species), indexed by the track position in the event; the
+// following requests for the same track, detector and species, from the same
+// or from any other user, are served from the array. No value is computed
+// that was not requested, so the PID response is never called more often
+// than without the cache. Tracks that are not in the event track array
+// (e.g. TPC-only copies) are computed directly.
+//
+// The key includes the PID response configuration that the n-sigma depends
+// on (TPC eta/multiplicity corrections, tune on data, TOF start time of each
+// momentum bin), so users which configure the PID response differently get
+// values computed with their own settings (the cached values are dropped
+// when the configuration changes).
+//
+// The event object is reused by the input handlers, so the event is
+// identified by the event and PID response addresses together with run,
+// period, orbit and bunch crossing numbers, number of tracks and the
+// first and last track; Reset() forces the recomputation.
+// GetNComputed() and GetNServed() count the values computed with the PID
+// response and the ones served from the cache, to check the reuse.
+//
+
+#include <TObject.h>
+#include <vector>
+
+#include "AliPID.h"
+#include "AliPIDResponse.h"
+
+class AliVEvent;
+class AliVParticle;
+class AliVTrack;
+
+class AliPIDNSigmaCache : public TObject {
+ public:
+  AliPIDNSigmaCache();
+  virtual ~AliPIDNSigmaCache() {;}
+
+  static AliPIDNSigmaCache* Instance();
+
+  // n-sigma of the track, event is taken from the track if not given
+  Float_t NumberOfSigmas(const AliPIDResponse* pid, const AliVEvent* event, AliPIDResponse::EDetector det,
+                         const AliVTrack* track, AliPID::EParticleType type);
+  Float_t NumberOfSigmas(const AliPIDResponse* pid, AliPIDResponse::EDetector det, const AliVTrack* track, AliPID::EParticleType type)
+  { return NumberOfSigmas(pid, 0x0, det, track, type); }
+
+  void Reset();
+
+  Long64_t GetNComputed() const { return fNComputed; }
+  Long64_t GetNServed() const { return fNServed; }
+  virtual void Print(Option_t* option = "") const;
+
+  static const AliVEvent* GetEventOfTrack(const AliVTrack* track);
+
+ private:
+  AliPIDNSigmaCache(const AliPIDNSigmaCache&);
+  AliPIDNSigmaCache& operator=(const AliPIDNSigmaCache&);
+
+  Bool_t IsCurrent(const AliVEvent* event, const AliPIDResponse* pid);
+  void   SetCurrent(const AliVEvent* event, const AliPIDResponse* pid);
+  void   GetConfiguration(const AliPIDResponse* pid, std::vector<Float_t>& config) const;
+  Int_t  FindTrack(const AliVParticle* track) const;
+  void   AddBlock(Int_t det, Int_t type);
+
+  const AliVEvent*      fEvent;           //! event of the cached values
+  const AliPIDResponse* fPIDResponse;     //! PID response of the cached values
+  Int_t    fRunNumber;                    //! run number of the event
+  UInt_t   fPeriodNumber;                 //! period number of the event
+  UInt_t   fOrbitNumber;                  //! orbit number of the event
+  UShort_t fBunchCrossNumber;             //! bunch crossing number of the event
+  Int_t    fNTracks;                      //! number of tracks of the event
+  Double_t fFirstPt;                      //! pt of the first track
+  Double_t fLastPt;                       //! pt of the last track
+  std::vector<const AliVParticle*> fTracks; //! tracks of the event
+  std::vector<Int_t> fSorted;             //! track indices sorted by track address
+  Int_t    fBlock[AliPIDResponse::kNdetectors][AliPID::kSPECIESC]; //! offset of the (detector, species) values in fNSigma, -1 if not allocated
+  std::vector<Float_t> fNSigma;           //! n-sigma values, one block of fNTracks per (detector, species)
+  std::vector<Float_t> fConfig;           //! PID response configuration of the cached values
+  std::vector<Float_t> fConfigNow;        //! PID response configuration at the current request
+  Long64_t fNComputed;                    //! number of values computed with the PID response
+  Long64_t fNServed;                      //! number of values served from the cache
+
+  static AliPIDNSigmaCache* fgInstance;   //! shared instance
+
+  ClassDef(AliPIDNSigmaCache, 2); // event-scoped cache of the PID response n-sigma
+};
+
+#endif
@@ -360,6 +360,38 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillBins(Int_t n, const Long64_t* bins, Int_t istep, const Double_t* weights)
+{
+  // fills n entries given by their global bin index (see GetGlobalBinIndex), bins < 0 are skipped
+  // this is the same as n calls to Fill, for callers which have already computed the bins
+  
+  for (Int_t k=0; k<n; k++)
+  {
+    const Long64_t bin = bins[k];
+    if (bin < 0)
+      continue;
+    
+    if (!fValues[istep])
+    {
+      fValues[istep] = new TemplateArray(fNBins);
+      AliInfo(Form("Created values container for step %d", istep));
+    }
+    
+    const Double_t weight = weights[k];
+    if (weight != 1 && !fSumw2[istep])
+    {
+      // see Fill
+      fSumw2[istep] = new TemplateArray(*fValues[istep]);
+      AliInfo(Form("Created sumw2 container for step %d", istep));
+    }
+    
+    fValues[istep]->GetArray()[bin] += weight;
+    if (fSumw2[istep])
+      fSumw2[istep]->GetArray()[bin] += weight * weight;
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
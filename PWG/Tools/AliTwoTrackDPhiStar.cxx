@@ -0,0 +1,188 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//
+// Two-track merging variable dphi* and its minimum over a radial range
+// (see the header for the description of the method)
+//
+
+#include <algorithm>
+
+#include "AliTwoTrackDPhiStar.h"
+
+ClassImp(AliTwoTrackDPhiStar)
+
+//________________________________________________________________________
+AliTwoTrackDPhiStar::AliTwoTrackDPhiStar(Double_t minRadius, Double_t maxRadius, Double_t step, Bool_t includeMax) :
+  TObject(),
+  fMinRadius(0),
+  fMaxRadius(0),
+  fStep(0),
+  fIncludeMax(kFALSE),
+  fRadius()
+{
+  // constructor
+  SetRadialScan(minRadius, maxRadius, step, includeMax);
+}
+
+//________________________________________________________________________
+void AliTwoTrackDPhiStar::SetRadialScan(Double_t minRadius, Double_t maxRadius, Double_t step, Bool_t includeMax)
+{
+  // Sets the radii of the scan, built in the same way as the loop
+  // for (rad = minRadius; rad < maxRadius (or <= if includeMax); rad += step)
+
+  fMinRadius = minRadius;
+  fMaxRadius = maxRadius;
+  fStep = step;
+  fIncludeMax = includeMax;
+  fRadius.clear();
+  if (step <= 0)
+    return;
+  for (Double_t rad = minRadius; includeMax ? rad <= maxRadius : rad < maxRadius; rad += step)
+    fRadius.push_back(rad);
+}
+
+//________________________________________________________________________
+Float_t AliTwoTrackDPhiStar::FoldDPhiStar(Float_t dphistar)
+{
+  // brings dphi* into [-pi, pi]
+
+  static const Double_t kPi = TMath::Pi();
+
+  if (dphistar > kPi)
+    dphistar = kPi * 2 - dphistar;
+  if (dphistar < -kPi)
+    dphistar = -kPi * 2 - dphistar;
+  if (dphistar > kPi) // might look funny but is needed
+    dphistar = kPi * 2 - dphistar;
+
+  return dphistar;
+}
+
+//________________________________________________________________________
+Float_t AliTwoTrackDPhiStar::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign)
+{
+  //
+  // calculates dphistar
+  //
+
+  return FoldDPhiStar(GetRawDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, radius, bSign));
+}
+
+//________________________________________________________________________
+Float_t AliTwoTrackDPhiStar::ScanMinDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t bSign) const
+{
+  // plain scan over all the radii
+
+  Float_t dphistarminabs = 1e5;
+  Float_t dphistarmin = 1e5;
+  for (UInt_t i = 0; i < fRadius.size(); i++)
+  {
+    Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fRadius[i], bSign);
+    Float_t dphistarabs = TMath::Abs(dphistar);
+    if (dphistarabs < dphistarminabs)
+    {
+      dphistarmin = dphistar;
+      dphistarminabs = dphistarabs;
+    }
+  }
+  return dphistarmin;
+}
+
+//________________________________________________________________________
+Int_t AliTwoTrackDPhiStar::FindCrossing(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t bSign, Double_t value, Int_t direction) const
+{
+  // first radius of the scan where the (monotonic) unfolded dphi* reaches value
+  // direction is +1 (-1) for dphi* increasing (decreasing) with the radius
+
+  Int_t lo = 0;
+  Int_t hi = fRadius.size();
+  while (lo < hi)
+  {
+    Int_t mid = (lo + hi) / 2;
+    Float_t raw = GetRawDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fRadius[mid], bSign);
+    if (direction * (raw - value) >= 0)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo;
+}
+
+//________________________________________________________________________
+Float_t AliTwoTrackDPhiStar::GetMinDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t bSign) const
+{
+  // Returns dphi* at the radius of the scan where |dphi*| is smallest
+  // (the first one in case of equal values), as the plain scan would.
+  // Only the ends of the range and the radii next to the crossings of 0 and +-2pi are evaluated.
+
+  static const Double_t kPi = TMath::Pi();
+
+  Int_t n = fRadius.size();
+  if (n < 3)
+    return ScanMinDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+
+  // the plain scan is kept when dphi* may not be monotonic (charges other than +-1)
+  if (TMath::Abs(charge1) != 1 || TMath::Abs(charge2) != 1)
+    return ScanMinDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+
+  // the plain scan is kept when a track does not reach the last radius (undefined dphi*)
+  if (!(pt1 > 0) || !(pt2 > 0) || fRadius[0] < 0 || 0.075 * fRadius[n-1] / pt1 > 1 || 0.075 * fRadius[n-1] / pt2 > 1)
+    return ScanMinDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+
+  Float_t first = GetRawDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fRadius[0], bSign);
+  Float_t last = GetRawDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fRadius[n-1], bSign);
+  if (!(TMath::Abs(first) < 3 * kPi) || !(TMath::Abs(last) < 3 * kPi))
+    return ScanMinDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+
+  // constant in the radius
+  if (first == last)
+    return FoldDPhiStar(first);
+  Int_t direction = (last > first) ? 1 : -1;
+
+  // candidates: the ends of the range and, for each crossing of a multiple of 2pi,
+  // the first radii on both sides of it (the first of equal values on each side)
+  Int_t candidates[8];
+  Int_t nCandidates = 0;
+  candidates[nCandidates++] = 0;
+  candidates[nCandidates++] = n - 1;
+  const Double_t targets[3] = { -2 * kPi, 0, 2 * kPi };
+  for (Int_t t = 0; t < 3; t++)
+  {
+    if (direction * (targets[t] - first) <= 0 || direction * (targets[t] - last) > 0)
+      continue;
+    Int_t above = FindCrossing(phi1, pt1, charge1, phi2, pt2, charge2, bSign, targets[t], direction);
+    candidates[nCandidates++] = above;
+    Float_t below = GetRawDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fRadius[above-1], bSign);
+    candidates[nCandidates++] = FindCrossing(phi1, pt1, charge1, phi2, pt2, charge2, bSign, below, direction);
+  }
+  std::sort(candidates, candidates + nCandidates);
+
+  Float_t dphistarminabs = 1e5;
+  Float_t dphistarmin = 1e5;
+  for (Int_t i = 0; i < nCandidates; i++)
+  {
+    if (i > 0 && candidates[i] == candidates[i-1])
+      continue;
+    Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fRadius[candidates[i]], bSign);
+    Float_t dphistarabs = TMath::Abs(dphistar);
+    if (dphistarabs < dphistarminabs)
+    {
+      dphistarmin = dphistar;
+      dphistarminabs = dphistarabs;
+    }
+  }
+  return dphistarmin;
+}
@@ -0,0 +1,60 @@
+#ifndef ALITWOTRACKDPHISTAR_H
+#define ALITWOTRACKDPHISTAR_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//
+// Two-track merging variable dphi* (azimuthal distance of the two tracks
+// at a given radius in the TPC) and its minimum over a radial range,
+// as used in the two-track efficiency cuts of the correlation,
+// balance function and femtoscopy analyses.
+//
+// The minimum is computed over the same grid of radii as the scan
+// for (rad = min; rad < max; rad += step) used by these analyses, with the
+// same result, but with a few evaluations instead of one per radius:
+// for tracks of unit charge dphi* is monotonic in the radius (its derivative
+// never vanishes, except for like-sign tracks with equal pt where it is
+// constant), so the minimum of |dphi*| is at one end of the range or next
+// to a zero crossing. Other charges (e.g. |q| = 2) use the plain scan.
+//
+
+#include <TObject.h>
+#include <TMath.h>
+#include <vector>
+
+class AliTwoTrackDPhiStar : public TObject {
+ public:
+  AliTwoTrackDPhiStar(Double_t minRadius=0.8, Double_t maxRadius=2.51, Double_t step=0.01, Bool_t includeMax=kFALSE);
+  virtual ~AliTwoTrackDPhiStar() {;}
+
+  void SetRadialScan(Double_t minRadius, Double_t maxRadius, Double_t step=0.01, Bool_t includeMax=kFALSE);
+  Bool_t HasRadialScan(Double_t minRadius, Double_t maxRadius, Double_t step=0.01, Bool_t includeMax=kFALSE) const
+  { return minRadius == fMinRadius && maxRadius == fMaxRadius && step == fStep && includeMax == fIncludeMax; }
+  Int_t GetNRadii() const { return fRadius.size(); }
+  Float_t GetRadius(Int_t i) const { return fRadius[i]; }
+
+  // dphi* at the given radius (m), bSign is the sign of the magnetic field
+  static Float_t GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign);
+
+  // dphi* at the radius of the scan where |dphi*| is smallest (1e5 if undefined)
+  Float_t GetMinDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t bSign) const;
+
+ private:
+  static Float_t GetRawDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign)
+  { return phi1 - phi2 - charge1 * bSign * TMath::ASin(0.075 * radius / pt1) + charge2 * bSign * TMath::ASin(0.075 * radius / pt2); }
+  static Float_t FoldDPhiStar(Float_t dphistar);
+
+  Float_t ScanMinDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t bSign) const;
+  Int_t   FindCrossing(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t bSign, Double_t value, Int_t direction) const;
+
+  Double_t fMinRadius;          // first radius of the scan
+  Double_t fMaxRadius;          // end of the scan
+  Double_t fStep;               // step of the scan
+  Bool_t   fIncludeMax;         // scan up to fMaxRadius included
+  std::vector<Float_t> fRadius; // radii of the scan
+
+  ClassDef(AliTwoTrackDPhiStar, 1); // two-track merging variable dphi*
+};
+
+#endif
@@ -9,6 +9,7 @@
 #pragma link C++ class AliFigure+;
 #pragma link C++ class AliCanvas+;
 #pragma link C++ class AliHelperPID+;
+#pragma link C++ class AliPIDNSigmaCache+;
 #pragma link C++ class AliLatexTable+;
 #pragma link C++ class AliNamedArrayI+;
 #pragma link C++ class AliNamedString+;
@@ -30,6 +31,7 @@
 #pragma link C++ class AliJSONString+;
 #pragma link C++ class AliAnalysisTaskDummy+;
 #pragma link C++ class AliTLorentzVector+;
+#pragma link C++ class AliTwoTrackDPhiStar+;
 #pragma link C++ namespace TestTHistManager;
 #pragma link C++ class TestTHistManager::THistManagerTestSuite;
 #pragma link C++ function TestTHistManager::TestRunAll();
@@ -86,6 +86,49 @@ namespace {
   const TString kKeySPsiP     = "FSigmaPsiP"; //Factor to fix the psi' sigma to sigmaJPsi*SigmaPsiP (Usually factor SigmaPsiP = 1, 0.9 and 1.1)
   const TString kKeyMinvRS    = "MinvRS"; // FIXME: not very correct since "MinvRS" is in AliAnalysisMuMu::GetParametersFromResult
 
+  //____________________________________________________________________________
+  struct CB2Tails
+  {
+    /// Constants of the power law tails of the extended crystal ball, for the
+    /// analytic integral of the shape (see IntegralCrystalBallExtended).
+
+    CB2Tails(Double_t alpha, Double_t n, Double_t alpha2, Double_t n2) :
+    fN(n), fN2(n2), fAbsAlpha(fabs(alpha)), fAbsAlpha2(fabs(alpha2)), fA(0.), fB(0.), fC(0.), fD(0.)
+    {
+      fA = TMath::Power(n/fAbsAlpha,n)*exp(-0.5*fAbsAlpha*fAbsAlpha);
+      fB = n/fAbsAlpha - fAbsAlpha;
+      fC = TMath::Power(n2/fAbsAlpha2,n2)*exp(-0.5*fAbsAlpha2*fAbsAlpha2);
+      fD = n2/fAbsAlpha2 - fAbsAlpha2;
+    }
+
+    Double_t Integral(Double_t t1, Double_t t2) const
+    {
+      /// analytic integral of the normalized shape between t1 < t2
+      Double_t sum(0.);
+      // left tail
+      Double_t a = t1, b = TMath::Min(t2,-fAbsAlpha);
+      if ( a < b )
+      {
+        if ( fN == 1. ) sum += fA*(log(fB-a) - log(fB-b));
+        else sum += fA/(fN-1.)*(TMath::Power(fB-b,1.-fN) - TMath::Power(fB-a,1.-fN));
+      }
+      // gaussian core
+      a = TMath::Max(t1,-fAbsAlpha); b = TMath::Min(t2,fAbsAlpha2);
+      if ( a < b ) sum += TMath::Sqrt(TMath::PiOver2())*(TMath::Erf(b/TMath::Sqrt2()) - TMath::Erf(a/TMath::Sqrt2()));
+      // right tail
+      a = TMath::Max(t1,fAbsAlpha2); b = t2;
+      if ( a < b )
+      {
+        if ( fN2 == 1. ) sum += fC*(log(fD+b) - log(fD+a));
+        else sum += fC/(1.-fN2)*(TMath::Power(fD+b,1.-fN2) - TMath::Power(fD+a,1.-fN2));
+      }
+      return sum;
+    }
+
+    Double_t fN, fN2;
+    Double_t fAbsAlpha, fAbsAlpha2;
+    Double_t fA, fB, fC, fD;
+  };
 }
 
 //_____________________________________________________________________________
@@ -637,6 +680,94 @@ Double_t AliAnalysisMuMuJpsiResult::FitFunctionSignalCrystalBallExtended(Double_
   return 0. ;
 }
 
+//____________________________________________________________________________
+Double_t AliAnalysisMuMuJpsiResult::IntegralCrystalBallExtended(Double_t xmin, Double_t xmax, const Double_t* par)
+{
+  /// Analytic integral of the extended crystal ball between xmin and xmax,
+  /// to be used instead of the numerical TF1::Integral.
+
+  if ( xmax <= xmin ) return 0.;
+
+  CB2Tails tails(par[3],par[4],par[5],par[6]);
+
+  Double_t t1 = (xmin-par[1])/par[2];
+  Double_t t2 = (xmax-par[1])/par[2];
+  if (par[3] < 0)
+  {
+    t1 = -t1;
+    t2 = -t2;
+  }
+  if ( t1 > t2 )
+  {
+    Double_t tmp = t1;
+    t1 = t2;
+    t2 = tmp;
+  }
+
+  return par[0]*fabs(par[2])*tails.Integral(t1,t2);
+}
+
+//____________________________________________________________________________
+Double_t AliAnalysisMuMuJpsiResult::IntegralErrorCrystalBallExtended(Double_t xmin, Double_t xmax, const Double_t* par, const Double_t* covMatrix)
+{
+  /// Error on the analytic integral of the extended crystal ball, propagated from the
+  /// 7x7 covariance matrix of the parameters (as TF1::IntegralError), with the gradient
+  /// of the integral computed by central differences of the analytic integral.
+  /// The parameters with no variance (fixed in the fit) do not contribute.
+
+  const Int_t npar = 7;
+  Double_t grad[npar];
+  Double_t p[npar];
+  for ( Int_t i = 0; i < npar; ++i ) p[i] = par[i];
+
+  for ( Int_t i = 0; i < npar; ++i )
+  {
+    grad[i] = 0.;
+    if ( covMatrix[i*npar+i] <= 0. ) continue;
+    Double_t h = 1E-3*TMath::Sqrt(covMatrix[i*npar+i]);
+    if ( par[i] != 0. ) h = TMath::Min(h,1E-3*fabs(par[i]));
+    if ( h <= 0. ) continue;
+    p[i] = par[i] + h;
+    Double_t up = IntegralCrystalBallExtended(xmin,xmax,p);
+    p[i] = par[i] - h;
+    Double_t down = IntegralCrystalBallExtended(xmin,xmax,p);
+    p[i] = par[i];
+    grad[i] = (up-down)/(2.*h);
+  }
+
+  Double_t err2(0.);
+  for ( Int_t i = 0; i < npar; ++i )
+  {
+    for ( Int_t j = 0; j < npar; ++j )
+    {
+      err2 += grad[i]*covMatrix[i*npar+j]*grad[j];
+    }
+  }
+  return TMath::Sqrt(TMath::Max(err2,0.));
+}
+
+//____________________________________________________________________________
+Double_t AliAnalysisMuMuJpsiResult::IntegralSignalCB2(TF1* signal, Double_t xmin, Double_t xmax) const
+{
+  /// Integral of the extended crystal ball signal function between xmin and xmax,
+  /// computed analytically. With debug level >= 1 it is compared to the numerical
+  /// TF1::Integral and a warning is issued if they differ.
+
+  Double_t integral = IntegralCrystalBallExtended(xmin,xmax,signal->GetParameters());
+
+  if ( AliDebugLevel() >= 1 )
+  {
+    Double_t numerical = signal->Integral(xmin,xmax);
+    if ( fabs(integral-numerical) > 1E-6*TMath::Max(fabs(numerical),1.) )
+    {
+      AliWarning(Form("%s : analytic integral %e differs from numerical integral %e in [%e,%e]",
+                      signal->GetName(),integral,numerical,xmin,xmax));
+    }
+  }
+
+  return integral;
+}
+
 //____________________________________________________________________________
 Double_t AliAnalysisMuMuJpsiResult::FitFunctionNA60New(Double_t *x,Double_t *par)
 {
@@ -2197,15 +2328,15 @@ void AliAnalysisMuMuJpsiResult::FitPSIPSIPRIMECB2VWG()
 
   Double_t a = fHisto->GetXaxis()->GetXmin();
   Double_t b = fHisto->GetXaxis()->GetXmax();
-  double njpsi = signalJPsi->Integral(a,b)/fHisto->GetBinWidth(1);
-  double nerr = signalJPsi->IntegralError(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi = IntegralSignalCB2(signalJPsi,a,b)/fHisto->GetBinWidth(1);
+  double nerr = IntegralErrorCrystalBallExtended(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi",njpsi,nerr);
 
   double m = GetValue("mJPsi");
   double s = GetValue("sJPsi");
-  double njpsi3s = signalJPsi->Integral(m-3*s,m+3*s)/fHisto->GetBinWidth(1);
-  double nerr3s = signalJPsi->IntegralError(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi3s = IntegralSignalCB2(signalJPsi,m-3*s,m+3*s)/fHisto->GetBinWidth(1);
+  double nerr3s = IntegralErrorCrystalBallExtended(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi3s",njpsi3s,nerr3s);
   //_____________________________
@@ -2433,15 +2564,15 @@ void AliAnalysisMuMuJpsiResult::FitPSIPSIPRIMECB2VWG2()
 
   Double_t a = fHisto->GetXaxis()->GetXmin();
   Double_t b = fHisto->GetXaxis()->GetXmax();
-  double njpsi = signalJPsi->Integral(a,b)/fHisto->GetBinWidth(1);
-  double nerr = signalJPsi->IntegralError(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi = IntegralSignalCB2(signalJPsi,a,b)/fHisto->GetBinWidth(1);
+  double nerr = IntegralErrorCrystalBallExtended(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi",njpsi,nerr);
 
   double m = GetValue("mJPsi");
   double s = GetValue("sJPsi");
-  double njpsi3s = signalJPsi->Integral(m-3*s,m+3*s)/fHisto->GetBinWidth(1);
-  double nerr3s = signalJPsi->IntegralError(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi3s = IntegralSignalCB2(signalJPsi,m-3*s,m+3*s)/fHisto->GetBinWidth(1);
+  double nerr3s = IntegralErrorCrystalBallExtended(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi3s",njpsi3s,nerr3s);
   //_____________________________
@@ -2730,15 +2861,15 @@ void AliAnalysisMuMuJpsiResult::FitPSIPSIPRIMECB2POL1POL2()
 
   Double_t a = fHisto->GetXaxis()->GetXmin();
   Double_t b = fHisto->GetXaxis()->GetXmax();
-  double njpsi = signalJPsi->Integral(a,b)/fHisto->GetBinWidth(1);
-  double nerr = signalJPsi->IntegralError(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi = IntegralSignalCB2(signalJPsi,a,b)/fHisto->GetBinWidth(1);
+  double nerr = IntegralErrorCrystalBallExtended(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi",njpsi,nerr);
 
   double m = GetValue("mJPsi");
   double s = GetValue("sJPsi");
-  double njpsi3s = signalJPsi->Integral(m-3*s,m+3*s)/fHisto->GetBinWidth(1);
-  double nerr3s = signalJPsi->IntegralError(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi3s = IntegralSignalCB2(signalJPsi,m-3*s,m+3*s)/fHisto->GetBinWidth(1);
+  double nerr3s = IntegralErrorCrystalBallExtended(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi3s",njpsi3s,nerr3s);
   //_____________________________
@@ -2973,15 +3104,15 @@ void AliAnalysisMuMuJpsiResult::FitPSIPSIPRIMECB2POL2POL3()
 
   Double_t a   = fHisto->GetXaxis()->GetXmin();
   Double_t b   = fHisto->GetXaxis()->GetXmax();
-  double njpsi = signalJPsi->Integral(a,b)/fHisto->GetBinWidth(1);
-  double nerr  = signalJPsi->IntegralError(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi = IntegralSignalCB2(signalJPsi,a,b)/fHisto->GetBinWidth(1);
+  double nerr  = IntegralErrorCrystalBallExtended(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi",njpsi,nerr);
 
   double m       = GetValue("mJPsi");
   double s       = GetValue("sJPsi");
-  double njpsi3s = signalJPsi->Integral(m-3*s,m+3*s)/fHisto->GetBinWidth(1);
-  double nerr3s  = signalJPsi->IntegralError(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi3s = IntegralSignalCB2(signalJPsi,m-3*s,m+3*s)/fHisto->GetBinWidth(1);
+  double nerr3s  = IntegralErrorCrystalBallExtended(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi3s",njpsi3s,nerr3s);
   //_____________________________
@@ -3201,15 +3332,15 @@ void AliAnalysisMuMuJpsiResult::FitPSIPSIPRIMECB2POL2POL3V2()
 
   Double_t a   = fHisto->GetXaxis()->GetXmin();
   Double_t b   = fHisto->GetXaxis()->GetXmax();
-  double njpsi = signalJPsi->Integral(a,b)/fHisto->GetBinWidth(1);
-  double nerr  = signalJPsi->IntegralError(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi = IntegralSignalCB2(signalJPsi,a,b)/fHisto->GetBinWidth(1);
+  double nerr  = IntegralErrorCrystalBallExtended(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi",njpsi,nerr);
 
   double m       = GetValue("mJPsi");
   double s       = GetValue("sJPsi");
-  double njpsi3s = signalJPsi->Integral(m-3*s,m+3*s)/fHisto->GetBinWidth(1);
-  double nerr3s  = signalJPsi->IntegralError(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi3s = IntegralSignalCB2(signalJPsi,m-3*s,m+3*s)/fHisto->GetBinWidth(1);
+  double nerr3s  = IntegralErrorCrystalBallExtended(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi3s",njpsi3s,nerr3s);
   //_____________________________
@@ -3582,15 +3713,15 @@ void AliAnalysisMuMuJpsiResult::FitPSIPSIPRIMECB2VWGINDEPTAILS()
 
   Double_t a = fHisto->GetXaxis()->GetXmin();
   Double_t b = fHisto->GetXaxis()->GetXmax();
-  double njpsi = signalJPsi->Integral(a,b)/fHisto->GetBinWidth(1);
-  double nerr = signalJPsi->IntegralError(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi = IntegralSignalCB2(signalJPsi,a,b)/fHisto->GetBinWidth(1);
+  double nerr = IntegralErrorCrystalBallExtended(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi",njpsi,nerr);
 
   double m = GetValue("mJPsi");
   double s = GetValue("sJPsi");
-  double njpsi3s = signalJPsi->Integral(m-3*s,m+3*s)/fHisto->GetBinWidth(1);
-  double nerr3s = signalJPsi->IntegralError(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi3s = IntegralSignalCB2(signalJPsi,m-3*s,m+3*s)/fHisto->GetBinWidth(1);
+  double nerr3s = IntegralErrorCrystalBallExtended(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi3s",njpsi3s,nerr3s);
 }
@@ -3796,15 +3927,15 @@ void AliAnalysisMuMuJpsiResult::FitPSIPSIPRIMECB2POL2EXP()
 
   Double_t a = fHisto->GetXaxis()->GetXmin();
   Double_t b = fHisto->GetXaxis()->GetXmax();
-  double njpsi = signalJPsi->Integral(a,b)/fHisto->GetBinWidth(1);
-  double nerr = signalJPsi->IntegralError(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi = IntegralSignalCB2(signalJPsi,a,b)/fHisto->GetBinWidth(1);
+  double nerr = IntegralErrorCrystalBallExtended(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi",njpsi,nerr);
 
   double m = GetValue("mJPsi");
   double s = GetValue("sJPsi");
-  double njpsi3s = signalJPsi->Integral(m-3*s,m+3*s)/fHisto->GetBinWidth(1);
-  double nerr3s = signalJPsi->IntegralError(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi3s = IntegralSignalCB2(signalJPsi,m-3*s,m+3*s)/fHisto->GetBinWidth(1);
+  double nerr3s = IntegralErrorCrystalBallExtended(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi3s",njpsi3s,nerr3s);
   //_____________________________
@@ -4057,15 +4188,15 @@ void AliAnalysisMuMuJpsiResult::FitPSIPSIPRIMECB2POL4EXP()
 
   Double_t a = fHisto->GetXaxis()->GetXmin();
   Double_t b = fHisto->GetXaxis()->GetXmax();
-  double njpsi = signalJPsi->Integral(a,b)/fHisto->GetBinWidth(1);
-  double nerr = signalJPsi->IntegralError(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi = IntegralSignalCB2(signalJPsi,a,b)/fHisto->GetBinWidth(1);
+  double nerr = IntegralErrorCrystalBallExtended(a,b,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi",njpsi,nerr);
 
   double m = GetValue("mJPsi");
   double s = GetValue("sJPsi");
-  double njpsi3s = signalJPsi->Integral(m-3*s,m+3*s)/fHisto->GetBinWidth(1);
-  double nerr3s = signalJPsi->IntegralError(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
+  double njpsi3s = IntegralSignalCB2(signalJPsi,m-3*s,m+3*s)/fHisto->GetBinWidth(1);
+  double nerr3s = IntegralErrorCrystalBallExtended(m-3*s,m+3*s,&cbParameters[0],&covarianceMatrix[0][0])/fHisto->GetBinWidth(1);
 
   Set("NofJPsi3s",njpsi3s,nerr3s);
   //_____________________________
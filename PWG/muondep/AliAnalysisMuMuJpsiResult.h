@@ -144,6 +144,11 @@ public:
 
   static Double_t CountParticle(const TH1& hminv, const char* particle, Double_t sigma=-1.0);
 
+  /// Analytic integral of the extended crystal ball (same parameters as FitFunctionSignalCrystalBallExtended)
+  static Double_t IntegralCrystalBallExtended(Double_t xmin, Double_t xmax, const Double_t* par);
+  /// Error on the analytic integral of the extended crystal ball, from the 7x7 covariance matrix
+  static Double_t IntegralErrorCrystalBallExtended(Double_t xmin, Double_t xmax, const Double_t* par, const Double_t* covMatrix);
+
   virtual AliAnalysisMuMuJpsiResult* Mother() const { return static_cast<AliAnalysisMuMuJpsiResult*>(AliAnalysisMuMuResult::Mother()); }
 
   void PrintValue(const char* key, const char* opt, Double_t value, Double_t errorStat, Double_t rms=0.0) const;
@@ -195,6 +200,7 @@ private:
   Double_t FitFunctionBackgroundVWG2(Double_t* x, Double_t* par);
 
   Double_t FitFunctionSignalCrystalBallExtended(Double_t *x,Double_t *par);
+  Double_t IntegralSignalCB2(TF1* signal, Double_t xmin, Double_t xmax) const;
 
   Double_t FitFunctionNA60New(Double_t *x,Double_t *par);
 
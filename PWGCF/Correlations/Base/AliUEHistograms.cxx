@@ -74,6 +74,7 @@ AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const
   fWeightPerEvent(kFALSE),
   fPtOrder(kTRUE),
   fTwoTrackCutMinRadius(0.8),
+  fDPhiStar(),
   fRunNumber(0),
   fMergeCount(1)
 {
@@ -244,6 +245,7 @@ AliUEHistograms::AliUEHistograms(const AliUEHistograms &c) :
   fWeightPerEvent(kFALSE),
   fPtOrder(kTRUE),
   fTwoTrackCutMinRadius(0.8),
+  fDPhiStar(),
   fRunNumber(0),
   fMergeCount(1)
 {
@@ -551,6 +553,10 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
   if (weight < 0)
     fillpT = kTRUE;
   
+  // radii of the dphi* scan of the two-track cut
+  if (twoTrackEfficiencyCut && !fDPhiStar.HasRadialScan(fTwoTrackCutMinRadius, 2.51))
+    fDPhiStar.SetRadialScan(fTwoTrackCutMinRadius, 2.51);
+
   if (twoTrackEfficiencyCut && !fTwoTrackDistancePt[0])
   {
     // do not add this hists to the directory
@@ -832,22 +838,11 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	    
 	    const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
 
-	    Float_t dphistarminabs = 1e5;
-	    Float_t dphistarmin = 1e5;
 	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
 	    {
-	      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
-	      {
-		Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
-
-		Float_t dphistarabs = TMath::Abs(dphistar);
-		
-		if (dphistarabs < dphistarminabs)
-		{
-		  dphistarmin = dphistar;
-		  dphistarminabs = dphistarabs;
-		}
-	      }
+	      // minimum over the radii fTwoTrackCutMinRadius, ..., 2.5 in steps of 0.01
+	      Float_t dphistarmin = fDPhiStar.GetMinDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+	      Float_t dphistarminabs = TMath::Abs(dphistarmin);
 	      
 	      fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
 	      
@@ -10,6 +10,7 @@
 
 #include "TNamed.h"
 #include "AliUEHist.h"
+#include "AliTwoTrackDPhiStar.h"
 #include "TMath.h"
 #include "THn.h" // in cxx file causes .../THn.h:257: error: conflicting declaration ‘typedef class THnT<float> THnF’
 
@@ -155,12 +156,13 @@ protected:
   Bool_t fWeightPerEvent;	// weight with the number of trigger particles per event
   Bool_t fPtOrder;		// apply pT,a < pT,t condition
   Float_t fTwoTrackCutMinRadius; // min radius for TTR cut
+  AliTwoTrackDPhiStar fDPhiStar; //! dphi* scan of the TTR cut
   
   Long64_t fRunNumber;           // run number that has been processed
   
   Int_t fMergeCount;		// counts how many objects have been merged together
   
-  ClassDef(AliUEHistograms, 30)  // underlying event histogram container
+  ClassDef(AliUEHistograms, 31)  // underlying event histogram container
 };
 
 Float_t AliUEHistograms::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign)
@@ -169,24 +171,7 @@ Float_t AliUEHistograms::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1,
   // calculates dphistar
   //
   
-  Float_t dphistar = phi1 - phi2 - charge1 * bSign * TMath::ASin(0.075 * radius / pt1) + charge2 * bSign * TMath::ASin(0.075 * radius / pt2);
-  
-  static const Double_t kPi = TMath::Pi();
-  
-  // circularity
-//   if (dphistar > 2 * kPi)
-//     dphistar -= 2 * kPi;
-//   if (dphistar < -2 * kPi)
-//     dphistar += 2 * kPi;
-  
-  if (dphistar > kPi)
-    dphistar = kPi * 2 - dphistar;
-  if (dphistar < -kPi)
-    dphistar = -kPi * 2 - dphistar;
-  if (dphistar > kPi) // might look funny but is needed
-    dphistar = kPi * 2 - dphistar;
-  
-  return dphistar;
+  return AliTwoTrackDPhiStar::GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, radius, bSign);
 }
 
 Float_t AliUEHistograms::GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2)
@@ -287,6 +287,7 @@ fHistdEdxVsPTPCbeforePIDelectron(NULL),
  ftwoTrackEfficiencyCutDataReco(kTRUE),
 fTwoTrackCutMinRadius(0.8),
 fTwoTrackCutMaxRadius(2.5),
+fDPhiStar(),
   twoTrackEfficiencyCutValue(0.02),
   fPID(NULL),
  fPIDCombined(NULL),
@@ -599,6 +600,7 @@ LambdaSigmahisto(0),
   ftwoTrackEfficiencyCutDataReco(kTRUE),
 fTwoTrackCutMinRadius(0.8),
 fTwoTrackCutMaxRadius(2.5),
+fDPhiStar(),
   twoTrackEfficiencyCutValue(0.02),
   fPID(NULL),
   fPIDCombined(NULL),
@@ -3996,23 +3998,14 @@ if (fRejectResonanceDaughters > 0)
 
  const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
 
-	    Float_t dphistarminabs = 1e5;
-	    Float_t dphistarmin = 1e5;
-
  if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
 	    {
-	      for (Double_t rad=fTwoTrackCutMinRadius; rad<=fTwoTrackCutMaxRadius; rad+=0.01) 
-	      {
-		Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
-
-		Float_t dphistarabs = TMath::Abs(dphistar);
+	      // minimum over the radii fTwoTrackCutMinRadius, ..., fTwoTrackCutMaxRadius in steps of 0.01
+	      if (!fDPhiStar.HasRadialScan(fTwoTrackCutMinRadius, fTwoTrackCutMaxRadius, 0.01, kTRUE))
+		fDPhiStar.SetRadialScan(fTwoTrackCutMinRadius, fTwoTrackCutMaxRadius, 0.01, kTRUE);
+	      Float_t dphistarmin = fDPhiStar.GetMinDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, bSign);
+	      Float_t dphistarminabs = TMath::Abs(dphistarmin);
 
-	if (dphistarabs < dphistarminabs)
-		{
-		  dphistarmin = dphistar;
-		  dphistarminabs = dphistarabs;
-		}
-	      }
 	      if(mixcase==kFALSE)  fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));//for same event
 	      if(mixcase==kTRUE)  fTwoTrackDistancePtmix[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));//for mixed event
 
@@ -5051,24 +5044,7 @@ Float_t  AliTwoParticlePIDCorr::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t c
   // calculates dphistar
   //
   
-  Float_t dphistar = phi1 - phi2 - charge1 * bSign * TMath::ASin(0.075 * radius / pt1) + charge2 * bSign * TMath::ASin(0.075 * radius / pt2);
-  
-  static const Double_t kPi = TMath::Pi();
-  
-  // circularity
-//   if (dphistar > 2 * kPi)
-//     dphistar -= 2 * kPi;
-//   if (dphistar < -2 * kPi)
-//     dphistar += 2 * kPi;
-  
-  if (dphistar > kPi)
-    dphistar = kPi * 2 - dphistar;
-  if (dphistar < -kPi)
-    dphistar = -kPi * 2 - dphistar;
-  if (dphistar > kPi) // might look funny but is needed
-    dphistar = kPi * 2 - dphistar;
-  
-  return dphistar;
+  return AliTwoTrackDPhiStar::GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, radius, bSign);
 }
 
 //------------------------------------------------------------------------
@@ -45,6 +45,7 @@ class TProfile;
 #include "TParticle.h"
 #include "AliLog.h"
 #include "AliTHn.h"
+#include "AliTwoTrackDPhiStar.h"
 #include "TBits.h"
 
 
@@ -618,6 +619,7 @@ fCutDaughterPtV0=CutDaughterPtV0;//switch to cut on the daughter of the V0 parti
      Bool_t ftwoTrackEfficiencyCutDataReco; 
     Float_t fTwoTrackCutMinRadius;
     Float_t fTwoTrackCutMaxRadius;	   
+    AliTwoTrackDPhiStar fDPhiStar; //! dphi* scan of the two-track cut
    Float_t twoTrackEfficiencyCutValue;
   //Pid objects
   AliPIDResponse *fPID; //! PID
@@ -756,7 +758,7 @@ Float_t GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float_t phi1, Float_t
     AliTwoParticlePIDCorr(const AliTwoParticlePIDCorr&); // not implemented
     AliTwoParticlePIDCorr& operator=(const AliTwoParticlePIDCorr&); // not implemented
     
-    ClassDef(AliTwoParticlePIDCorr, 1); // example of analysis
+    ClassDef(AliTwoParticlePIDCorr, 2); // example of analysis
 };
 class LRCParticlePID : public TObject {
 public:
@@ -63,7 +63,8 @@ AliJFFlucAnalysis::AliJFFlucAnalysis()
 		//fh_Qvector(),
 		fh_ntracks(),
 		fh_vn(),
-		fh_vn_vn()
+		fh_vn_vn(),
+		fQnTensorFilled(kFALSE)
 {
 		const int NCent = 7;
 		Double_t CentBin[NCent+1] = {0, 5, 10, 20, 30, 40, 50, 60};
@@ -116,7 +117,8 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const char *name)
 		//fh_Qvector(),
 		fh_ntracks(),
 		fh_vn(),
-		fh_vn_vn()
+		fh_vn_vn(),
+		fQnTensorFilled(kFALSE)
 {
 		cout << "analysis task created " << endl;
 		const int NCent = 7;
@@ -190,7 +192,8 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const AliJFFlucAnalysis& a):
 		//fh_Qvector(a.fh_Qvector),
 		fh_ntracks(a.fh_ntracks),
 		fh_vn(a.fh_vn),
-		fh_vn_vn(a.fh_vn_vn)
+		fh_vn_vn(a.fh_vn_vn),
+		fQnTensorFilled(kFALSE)
 {
 		//copy constructor
 		//	DefineOutput(1, TList::Class() ); 
@@ -361,6 +364,7 @@ AliJFFlucAnalysis::~AliJFFlucAnalysis() {
 void AliJFFlucAnalysis::UserExec(Option_t *) {
 		// Main loop
 		// init 
+		fQnTensorFilled = kFALSE;
 		for(int ih=0; ih<kNH; ih++){
 			for(int im=0; im<3; im++){ //method 
 				fSingleVn[ih][im] = -9999;
@@ -393,6 +397,10 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		Eta_config[kSubA][kMax] = fEta_max;  // 0.8 max for SubA
 		Eta_config[kSubB][kMin] = -1*fEta_max; // -0.8  min for SubB
 		Eta_config[kSubB][kMax] = -1*fEta_min; // -0.4  max for SubB
+		Double_t ptbin_borders[N_ptbins+1] = {0.2, 0.4, 0.6, 0.8, 1.0, 1.25, 1.5, 2.0, 5.0};
+
+		// all the SP Q-vectors (harmonics, sub-events, pt bins) in one track loop
+		CalculateQnTensor( Eta_config, ptbin_borders );
 
 		// use complex variable instead of doulbe Qn // 
 		TComplex QnA[kNH];
@@ -540,7 +548,6 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 
 		if(IsSCptdep == kTRUE){
 				const int SCNH =6; // 0, 1, 2(v2), 3(v3), 4(v4), 5(v5)
-				Double_t ptbin_borders[N_ptbins+1] = {0.2, 0.4, 0.6, 0.8, 1.0, 1.25, 1.5, 2.0, 5.0};
 				//init
 				TComplex QnA_pt[SCNH][N_ptbins];
 				TComplex QnB_pt[SCNH][N_ptbins];
@@ -684,6 +691,7 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 
 
 		//1 evt is done...
+		fQnTensorFilled = kFALSE;
 }
 
 //________________________________________________________________________
@@ -730,11 +738,92 @@ void AliJFFlucAnalysis::Fill_QA_plot( Double_t eta1, Double_t eta2 )
 		fh_TrkQA_TPCvsGlob->Fill( fGlbtrks, fTPCtrks);
 }
 //________________________________________________________________________
+void AliJFFlucAnalysis::CalculateQnTensor( Double_t etaRange[2][2], Double_t *ptBorders )
+{
+		// Q-vectors of the two sub-events for all harmonics, for all pt (eta edges included, as in CalculateQnSP)
+		// and in the pt bins (eta and pt edges excluded, as in Get_Qn_Real_pt/Get_Qn_Img_pt), filled in one track loop
+		// with the efficiency and phi module weight evaluated once per track.
+		// The sums are the same, in the same track order, as the ones of the per harmonic loops.
+		for(int i=0; i<kNQnTensor; i++) fQnTensor[i] = 0;
+		for(int isub=0; isub<2; isub++){
+				fQnTensorEta[isub][0] = etaRange[isub][0];
+				fQnTensorEta[isub][1] = etaRange[isub][1];
+		}
+		for(int ipt=0; ipt<=N_ptbins; ipt++) fQnTensorPt[ipt] = ptBorders[ipt];
+
+		Double_t cosn[kNH];
+		Double_t sinn[kNH];
+		Long64_t ntracks = fInputList->GetEntriesFast();
+		for(Long64_t it=0; it< ntracks; it++){
+				AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
+				Double_t pt = itrack->Pt();
+				Double_t eta = itrack->Eta();
+				int ipt = -1;
+				for(int i=0; i<N_ptbins; i++){
+						if( pt > ptBorders[i] && pt < ptBorders[i+1] ) ipt = i;
+				}
+				Bool_t hasWeight = kFALSE;
+				Double_t weight = 0;
+				for(int itensor=0; itensor<2; itensor++){
+						Bool_t inAllPt = !( eta < etaRange[itensor][0] || eta > etaRange[itensor][1] );
+						Bool_t inPtBin = ipt >= 0 && eta > etaRange[itensor][0] && eta < etaRange[itensor][1];
+						if( !inAllPt && !inPtBin ) continue;
+						if( !hasWeight ){
+								Double_t phi = itrack->Phi();
+								Double_t phi_module_corr = 1;
+								int isub = -1;
+								if( eta < 0 ) isub = 0;
+								if( eta > 0 ) isub = 1;
+								if( IsPhiModule == kTRUE){ phi_module_corr = h_phi_module[fCBin][isub]->GetBinContent( (h_phi_module[fCBin][isub]->GetXaxis()->FindBin( phi ) )  );}
+								Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent );
+								weight = 1./effCorr * phi_module_corr;
+								for(int ih=0; ih<kNH; ih++){
+										cosn[ih] = TMath::Cos(ih*phi);
+										sinn[ih] = TMath::Sin(ih*phi);
+								}
+								hasWeight = kTRUE;
+						}
+						if( inAllPt ){
+								Double_t *q = &fQnTensor[QnTensorIndex(itensor, kQnAllPt, 0, 0)];
+								for(int ih=0; ih<kNH; ih++){
+										q[2*ih] += weight * cosn[ih];
+										q[2*ih+1] += weight * sinn[ih];
+								}
+						}
+						if( inPtBin ){
+								Double_t *q = &fQnTensor[QnTensorIndex(itensor, ipt, 0, 0)];
+								for(int ih=0; ih<kNH; ih++){
+										q[2*ih] += weight * cosn[ih];
+										q[2*ih+1] += weight * sinn[ih];
+								}
+						}
+				}
+		}
+		fQnTensorFilled = kTRUE;
+}
+//________________________________________________________________________
+int AliJFFlucAnalysis::FindQnTensorSub( Double_t eta1, Double_t eta2 ) const
+{
+		// sub-event of the Q-vector tensor with this eta range, -1 if none
+		if( !fQnTensorFilled ) return -1;
+		for(int isub=0; isub<2; isub++){
+				if( eta1 == fQnTensorEta[isub][0] && eta2 == fQnTensorEta[isub][1] ) return isub;
+		}
+		return -1;
+}
+//________________________________________________________________________
 TComplex AliJFFlucAnalysis::CalculateQnSP( Double_t eta1, Double_t eta2, int harmonics)
 {
 		int ih=harmonics;
 		TComplex Qn = TComplex(0,0);
 		Double_t Sub_Ntrk = 0; // number of Tracks * effCorr * phi modulation factor 
+		int itensor = FindQnTensorSub( eta1, eta2 );
+		if( itensor >= 0 && ih >= 0 && ih < kNH ){ // already in the Q-vector tensor
+				Qn = TComplex( fQnTensor[QnTensorIndex(itensor, kQnAllPt, ih, 0)], fQnTensor[QnTensorIndex(itensor, kQnAllPt, ih, 1)] );
+				Sub_Ntrk = fQnTensor[QnTensorIndex(itensor, kQnAllPt, 0, 0)];
+				if( ih !=0) Qn /= Sub_Ntrk;
+				return Qn;
+		}
 		Long64_t ntracks = fInputList->GetEntriesFast();
 		for(Long64_t it=0; it< ntracks; it++){
 				AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
@@ -776,7 +865,14 @@ Double_t AliJFFlucAnalysis::Get_Qn_Real_pt(Double_t eta1, Double_t eta2, int har
 		Double_t Qn_real = 0;
 		Double_t Sub_Ntrk =0;
 
-		Long64_t ntracks = fInputList->GetEntriesFast();
+		int itensor = FindQnTensorSub( eta1, eta2 );
+		Bool_t inTensor = itensor >= 0 && nh >= 0 && nh < kNH && ptbin >= 0 && ptbin < N_ptbins
+				&& pt_min == fQnTensorPt[ptbin] && pt_max == fQnTensorPt[ptbin+1];
+		if( inTensor ){ // already in the Q-vector tensor
+				Qn_real = fQnTensor[QnTensorIndex(itensor, ptbin, nh, 0)];
+				Sub_Ntrk = fQnTensor[QnTensorIndex(itensor, ptbin, 0, 0)];
+		}
+		Long64_t ntracks = inTensor ? 0 : fInputList->GetEntriesFast();
 		for( Long64_t it=0; it< ntracks; it++){
 				AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
 				Double_t eta = itrack->Eta();
@@ -813,7 +909,14 @@ Double_t AliJFFlucAnalysis::Get_Qn_Img_pt(Double_t eta1, Double_t eta2, int harm
 		Double_t Qn_img = 0;
 		Double_t Sub_Ntrk =0;
 
-		Long64_t ntracks = fInputList->GetEntriesFast();
+		int itensor = FindQnTensorSub( eta1, eta2 );
+		Bool_t inTensor = itensor >= 0 && nh >= 0 && nh < kNH && ptbin >= 0 && ptbin < N_ptbins
+				&& pt_min == fQnTensorPt[ptbin] && pt_max == fQnTensorPt[ptbin+1];
+		if( inTensor ){ // already in the Q-vector tensor
+				Qn_img = fQnTensor[QnTensorIndex(itensor, ptbin, nh, 1)];
+				Sub_Ntrk = fQnTensor[QnTensorIndex(itensor, ptbin, 0, 0)];
+		}
+		Long64_t ntracks = inTensor ? 0 : fInputList->GetEntriesFast();
 		for( Long64_t it=0; it< ntracks; it++){
 				AliJBaseTrack *itrack = (AliJBaseTrack*)fInputList->At(it); // load track
 				Double_t eta = itrack->Eta();
@@ -56,6 +56,7 @@ class AliJFFlucAnalysis : public AliAnalysisTaskSE {
 
 		inline void DEBUG(int level, TString msg){if(level<fDebugLevel) std::cout<<level<<"\t"<<msg<<endl;};
 
+		void CalculateQnTensor( double etaRange[2][2], double *ptBorders );
 		TComplex CalculateQnSP( double eta1, double eta2, int harmonics);
 
 		double Get_Qn_Real_pt(double eta1, double eta2, int harmonics, int ipt, double pt_min, double pt_max);
@@ -149,6 +150,14 @@ class AliJFFlucAnalysis : public AliAnalysisTaskSE {
 		// addtinal variables for ptbins(Standard Candles only)
 		enum{kPt0, kPt1, kPt2, kPt3, kPt4, kPt5, kPt6, kPt7, N_ptbins};
 		double NSubTracks_pt[2][N_ptbins];
+		// Q-vectors of the two SP sub-events for all harmonics and pt bins, filled in one track loop by CalculateQnTensor
+		enum{kQnAllPt = N_ptbins, kNQnPt, kNQnTensor = 2*kNQnPt*kNH*2};
+		Double_t fQnTensor[kNQnTensor];//! // [isub][ipt][ih][re,im], ipt=kQnAllPt for all pt, [ih=0][re] is the sum of weights
+		Double_t fQnTensorEta[2][2];//! // eta range of the sub-events
+		Double_t fQnTensorPt[N_ptbins+1];//! // pt bin borders
+		Bool_t fQnTensorFilled;//! // tensor filled for the current event
+		int QnTensorIndex( int isub, int ipt, int ih, int iphase ) const { return ((isub*kNQnPt + ipt)*kNH + ih)*2 + iphase; }
+		int FindQnTensorSub( double eta1, double eta2 ) const;
 		AliJBin fBin_Nptbins;//!
 		AliJTH1D fh_SC_ptdep_4corr;//! // for < vn^2 vm^2 >
 		AliJTH1D fh_SC_ptdep_2corr;//!  // for < vn^2 >
@@ -160,7 +169,7 @@ class AliJFFlucAnalysis : public AliAnalysisTaskSE {
 		AliJTH1D fh_QvectorQCphi;//!
 		AliJTH1D fh_evt_SP_QC_ratio_2p;//! // check SP QC evt by evt ratio
 		AliJTH1D fh_evt_SP_QC_ratio_4p;//! // check SP QC evt by evt ratio
-		ClassDef(AliJFFlucAnalysis, 1); // example of analysis
+		ClassDef(AliJFFlucAnalysis, 2); // example of analysis
 };
 
 #endif
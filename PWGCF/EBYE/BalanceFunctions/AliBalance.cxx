@@ -50,6 +50,8 @@ AliBalance::AliBalance() :
   TObject(), 
   fShuffle(kFALSE),
   fHBTcut(kFALSE),
+  fHBTCutMinRadius(0.8),
+  fDPhiStar(),
   fConversionCut(kFALSE),
   fAnalysisLevel("ESD"),
   fAnalyzedEvents(0) ,
@@ -111,6 +113,8 @@ AliBalance::AliBalance(const AliBalance& balance):
   TObject(balance), 
   fShuffle(balance.fShuffle),
   fHBTcut(balance.fHBTcut), 
+  fHBTCutMinRadius(balance.fHBTCutMinRadius),
+  fDPhiStar(balance.fDPhiStar),
   fConversionCut(balance.fConversionCut), 
   fAnalysisLevel(balance.fAnalysisLevel),
   fAnalyzedEvents(balance.fAnalyzedEvents), 
@@ -285,6 +289,10 @@ void AliBalance::CalculateBalance(Float_t fCentrality,vector<Double_t> **chargeV
     InitHistograms();
   }
 
+  // radii of the dphi* scan of the HBT cut
+  if (fHBTcut && !fDPhiStar.HasRadialScan(fHBTCutMinRadius, 2.51))
+    fDPhiStar.SetRadialScan(fHBTCutMinRadius, 2.51);
+
   Int_t gNtrack = chargeVector[0]->size();
   //Printf("(AliBalance) Number of tracks: %d",gNtrack);
 
@@ -443,25 +451,15 @@ void AliBalance::CalculateBalance(Float_t fCentrality,vector<Double_t> **chargeV
 	      Float_t phi2rad = phi2*TMath::DegToRad();
 
 	      // check first boundaries to see if is worth to loop and find the minimum
-	      Float_t dphistar1 = GetDPhiStar(phi1rad, pt1, charge1, phi2rad, pt2, charge2, 0.8, bSign);
+	      Float_t dphistar1 = GetDPhiStar(phi1rad, pt1, charge1, phi2rad, pt2, charge2, fHBTCutMinRadius, bSign);
 	      Float_t dphistar2 = GetDPhiStar(phi1rad, pt1, charge1, phi2rad, pt2, charge2, 2.5, bSign);
 	      
 	      const Float_t kLimit = 0.02 * 3;
 	      
-	      Float_t dphistarminabs = 1e5;
-
 	      if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0 )
 		{
-		  for (Double_t rad=0.8; rad<2.51; rad+=0.01) 
-		    {
-		      Float_t dphistar = GetDPhiStar(phi1rad, pt1, charge1, phi2rad, pt2, charge2, rad, bSign);
-		      Float_t dphistarabs = TMath::Abs(dphistar);
-		      
-		      if (dphistarabs < dphistarminabs)
-			{
-			  dphistarminabs = dphistarabs;
-			}
-		    }
+		  // minimum over the radii fHBTCutMinRadius, ..., 2.5 in steps of 0.01
+		  Float_t dphistarminabs = TMath::Abs(fDPhiStar.GetMinDPhiStar(phi1rad, pt1, charge1, phi2rad, pt2, charge2, bSign));
 		
 		  if (dphistarminabs < 0.02 && TMath::Abs(deta) < 0.02)
 		    {
@@ -63,6 +63,8 @@ AliBalanceEbyE::AliBalanceEbyE() :
   fResonancesCut(kFALSE),
   fHBTCut(kFALSE),
   fHBTCutValue(0.02),
+  fHBTCutMinRadius(0.8),
+  fDPhiStar(),
   fConversionCut(kFALSE),
   fInvMassCutConversion(0.04),
   fQCut(kFALSE),
@@ -98,6 +100,8 @@ AliBalanceEbyE::AliBalanceEbyE(const AliBalanceEbyE& balance):
   fResonancesCut(balance.fResonancesCut),
   fHBTCut(balance.fHBTCut),
   fHBTCutValue(balance.fHBTCutValue),
+  fHBTCutMinRadius(balance.fHBTCutMinRadius),
+  fDPhiStar(balance.fDPhiStar),
   fConversionCut(balance.fConversionCut),
   fInvMassCutConversion(balance.fInvMassCutConversion),
   fQCut(balance.fQCut),
@@ -182,6 +186,10 @@ void AliBalanceEbyE::CalculateBalance(Double_t gReactionPlane,
   // Calculates the balance function
   fAnalyzedEvents++;
 
+  // radii of the dphi* scan of the HBT cut
+  if (fHBTCut && !fDPhiStar.HasRadialScan(fHBTCutMinRadius, 2.51))
+    fDPhiStar.SetRadialScan(fHBTCutMinRadius, 2.51);
+
   Double_t trackVariablesSingle[3];
   Double_t trackVariablesPair[6];
 
@@ -370,24 +378,14 @@ void AliBalanceEbyE::CalculateBalance(Double_t gReactionPlane,
 	    Float_t phi2rad = secondPhi[j];
 	    
 	    // check first boundaries to see if is worth to loop and find the minimum
-	    Float_t dphistar1 = GetDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, 0.8, bSign);
+	    Float_t dphistar1 = GetDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, fHBTCutMinRadius, bSign);
 	    Float_t dphistar2 = GetDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, 2.5, bSign);
 	    
 	    const Float_t kLimit = fHBTCutValue * 3;
 	    
-	    Float_t dphistarminabs = 1e5;
-	    //Float_t dphistarmin = 1e5;
-	    
 	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0 ) {
-	      for (Double_t rad=0.8; rad<2.51; rad+=0.01) {
-		Float_t dphistar = GetDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, rad, bSign);
-		Float_t dphistarabs = TMath::Abs(dphistar);
-		
-		if (dphistarabs < dphistarminabs) {
-		  //dphistarmin = dphistar;
-		  dphistarminabs = dphistarabs;
-		}
-	      }
+	      // minimum over the radii fHBTCutMinRadius, ..., 2.5 in steps of 0.01
+	      Float_t dphistarminabs = TMath::Abs(fDPhiStar.GetMinDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, bSign));
 	      
 	      if (dphistarminabs < fHBTCutValue && TMath::Abs(deta) < fHBTCutValue) {
 		continue;
@@ -492,20 +490,10 @@ void AliBalanceEbyE::CalculateBalance(Double_t gReactionPlane,
 
 
 //____________________________________________________________________//
-Float_t AliBalanceEbyE::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign) { 
+Float_t AliBalanceEbyE::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign) {
   //
   // calculates dphistar
   //
-  Float_t dphistar = phi1 - phi2 - charge1 * bSign * TMath::ASin(0.075 * radius / pt1) + charge2 * bSign * TMath::ASin(0.075 * radius / pt2);
-  
-  static const Double_t kPi = TMath::Pi();
-  
-  if (dphistar > kPi)
-    dphistar = kPi * 2 - dphistar;
-  if (dphistar < -kPi)
-    dphistar = -kPi * 2 - dphistar;
-  if (dphistar > kPi) // might look funny but is needed
-    dphistar = kPi * 2 - dphistar;
-  
-  return dphistar;
+
+  return AliTwoTrackDPhiStar::GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, radius, bSign);
 }
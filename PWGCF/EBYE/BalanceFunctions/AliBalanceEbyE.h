@@ -12,6 +12,8 @@
 #include "TObject.h"
 #include "TString.h"
 
+#include "AliTwoTrackDPhiStar.h"
+
 class TH2D;
 class TH3D;
 
@@ -57,6 +59,7 @@ class AliBalanceEbyE : public TObject {
   void UseResonancesCut() {fResonancesCut = kTRUE;}
   void UseHBTCut(Double_t setHBTCutValue = 0.02) {
     fHBTCut = kTRUE; fHBTCutValue = setHBTCutValue;}
+  void SetHBTCutMinRadius(Float_t min) {fHBTCutMinRadius = min;}
   void UseConversionCut(Double_t setInvMassCutConversion = 0.04) {
     fConversionCut = kTRUE; fInvMassCutConversion = setInvMassCutConversion; }
   void UseMomentumDifferenceCut(Double_t gDeltaPtCutMin) {
@@ -97,6 +100,8 @@ class AliBalanceEbyE : public TObject {
   Bool_t fResonancesCut;//resonances cut
   Bool_t fHBTCut;//cut for two-track efficiency (like HBT group)
   Double_t fHBTCutValue;// value for two-track efficiency cut (default = 0.02 from dphicorrelations)
+  Float_t fHBTCutMinRadius;// min radius of the dphi* scan of the two-track efficiency cut
+  AliTwoTrackDPhiStar fDPhiStar;//! dphi* scan of the two-track efficiency cut
   Bool_t fConversionCut;//conversion cut
   Double_t fInvMassCutConversion;//invariant mass for conversion cut
   Bool_t fQCut;//cut on momentum difference to suppress femtoscopic effect correlations
@@ -104,7 +109,7 @@ class AliBalanceEbyE : public TObject {
 
   AliBalanceEbyE & operator=(const AliBalanceEbyE & ) {return *this;}
 
-  ClassDef(AliBalanceEbyE, 1)
+  ClassDef(AliBalanceEbyE, 2)
 };
 
 #endif
@@ -15,6 +15,8 @@
 #include <TObject.h>
 #include "TString.h"
 
+#include "AliTwoTrackDPhiStar.h"
+
 using std::vector;
 
 #define ANALYSIS_TYPES	7
@@ -47,6 +49,7 @@ class AliBalanceEventMixing : public TObject {
     fAnalysisLevel = analysisLevel;}
   void SetShuffle(Bool_t shuffle) {fShuffle = shuffle;}
   void SetHBTcut(Bool_t HBTcut) {fHBTcut = HBTcut;}
+  void SetHBTCutMinRadius(Float_t min) {fHBTCutMinRadius = min;}
   void SetConversionCut(Bool_t ConversionCut) {fConversionCut = ConversionCut;}
   void SetInterval(Int_t iAnalysisType, Double_t p1Start, Double_t p1Stop,
 		   Int_t ibins, Double_t p2Start, Double_t p2Stop);
@@ -116,6 +119,8 @@ class AliBalanceEventMixing : public TObject {
 
   Bool_t fShuffle; //shuffled balance function object
   Bool_t fHBTcut;  // apply HBT like cuts
+  Float_t fHBTCutMinRadius; // min radius of the dphi* scan of the HBT cut
+  AliTwoTrackDPhiStar fDPhiStar; //! dphi* scan of the HBT cut
   Bool_t fConversionCut;  // apply conversion cuts
 
   TString fAnalysisLevel; //ESD, AOD or MC
@@ -151,33 +156,16 @@ class AliBalanceEventMixing : public TObject {
 
   AliBalanceEventMixing & operator=(const AliBalanceEventMixing & ) {return *this;}
 
-  ClassDef(AliBalanceEventMixing, 1)
+  ClassDef(AliBalanceEventMixing, 2)
 };
 
 Float_t AliBalanceEventMixing::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign)
-{ 
+{
   //
   // calculates dphistar
   //
-  
-  Float_t dphistar = phi1 - phi2 - charge1 * bSign * TMath::ASin(0.075 * radius / pt1) + charge2 * bSign * TMath::ASin(0.075 * radius / pt2);
-  
-  static const Double_t kPi = TMath::Pi();
-  
-  // circularity
-//   if (dphistar > 2 * kPi)
-//     dphistar -= 2 * kPi;
-//   if (dphistar < -2 * kPi)
-//     dphistar += 2 * kPi;
-  
-  if (dphistar > kPi)
-    dphistar = kPi * 2 - dphistar;
-  if (dphistar < -kPi)
-    dphistar = -kPi * 2 - dphistar;
-  if (dphistar > kPi) // might look funny but is needed
-    dphistar = kPi * 2 - dphistar;
-  
-  return dphistar;
+
+  return AliTwoTrackDPhiStar::GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, radius, bSign);
 }
 
 #endif
@@ -33,6 +33,8 @@
 #include <TString.h>
 #include <TSpline.h>
 #include <TRandom3.h>
+#include <TArrayI.h>
+#include <algorithm>
 
 #include "AliVParticle.h"
 #include "AliMCParticle.h"
@@ -48,6 +50,29 @@ using std::cerr;
 
 ClassImp(AliBalancePsi)
 
+namespace {
+  // orders particle indices by eta
+  struct EtaOrder {
+    EtaOrder(const Float_t* eta) : fEta(eta) {}
+    bool operator()(Int_t a, Int_t b) const { return fEta[a] < fEta[b]; }
+    const Float_t* fEta;
+  };
+
+  // first position in the eta ordered list where eta1 - eta < limit
+  // (eta1 - eta decreases along the list)
+  Int_t FirstDeltaEtaBelow(const std::vector<Int_t>& order, const Float_t* eta, Float_t eta1, Double_t limit) {
+    Int_t lo = 0;
+    Int_t hi = order.size();
+    while (lo < hi) {
+      Int_t mid = (lo + hi) / 2;
+      Float_t deta = eta1 - eta[order[mid]];
+      if (deta < limit) hi = mid;
+      else              lo = mid + 1;
+    }
+    return lo;
+  }
+}
+
 //____________________________________________________________________//
 AliBalancePsi::AliBalancePsi() :
   TObject(), 
@@ -82,11 +107,14 @@ AliBalancePsi::AliBalancePsi() :
   fResonancesCut(kFALSE),
   fHBTCut(kFALSE),
   fHBTCutValue(0.02),
+  fHBTCutMinRadius(0.8),
+  fDPhiStar(),
   fConversionCut(kFALSE),
   fInvMassCutConversion(0.04),
   fQCut(kFALSE),
   fDeltaPtMin(0.0),
   fVertexBinning(kFALSE),
+  fSortedPairLoop(kFALSE),
   fCustomBinning(""),
   fBinningString(""),
   fEventClass("EventPlane"){
@@ -126,11 +154,14 @@ AliBalancePsi::AliBalancePsi(const AliBalancePsi& balance):
   fResonancesCut(balance.fResonancesCut),
   fHBTCut(balance.fHBTCut),
   fHBTCutValue(balance.fHBTCutValue),
+  fHBTCutMinRadius(balance.fHBTCutMinRadius),
+  fDPhiStar(balance.fDPhiStar),
   fConversionCut(balance.fConversionCut),
   fInvMassCutConversion(balance.fInvMassCutConversion),
   fQCut(balance.fQCut),
   fDeltaPtMin(balance.fDeltaPtMin),
   fVertexBinning(balance.fVertexBinning),
+  fSortedPairLoop(balance.fSortedPairLoop),
   fCustomBinning(balance.fCustomBinning),
   fBinningString(balance.fBinningString),
   fEventClass("EventPlane"){
@@ -421,6 +452,10 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     InitHistograms();
   }
 
+  // radii of the dphi* scan of the HBT cut
+  if (fHBTCut && !fDPhiStar.HasRadialScan(fHBTCutMinRadius, 2.51))
+    fDPhiStar.SetRadialScan(fHBTCutMinRadius, 2.51);
+
   Double_t trackVariablesSingle[kTrackVariablesSingle];
   Double_t trackVariablesPair[kTrackVariablesPair];
 
@@ -451,6 +486,33 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     secondCharge[i]  = (Short_t)((AliVParticle*) particlesSecond->At(i))->Charge();
     secondCorrection[i]  = (Double_t)((AliBFBasicParticle*) particlesSecond->At(i))->Correction();   //==========================correction
   }
+
+  // Sorted pair loop: the associated particles are sorted in eta, so that only
+  // the pairs inside the Delta eta axis are visited, and their associated pT
+  // bins are computed once. The pair histograms are filled by global bin.
+  std::vector<Int_t> sortedSecond;
+  TArrayI  secondPtBin;
+  TAxis*   pairAxis[kTrackVariablesPair];
+  Int_t    pairNBins[kTrackVariablesPair];
+  Double_t pairDeltaEtaMin = 0.;
+  Double_t pairDeltaEtaMax = 0.;
+  std::vector<Long64_t> pairBins[2];    // [0]: charge2 > 0, [1]: charge2 < 0
+  std::vector<Double_t> pairWeights[2];
+  if (fSortedPairLoop) {
+    for (Int_t k = 0; k < kTrackVariablesPair; k++) {
+      pairAxis[k]  = fHistPN->GetAxis(k, 0);
+      pairNBins[k] = pairAxis[k]->GetNbins();
+    }
+    pairDeltaEtaMin = pairAxis[1]->GetXmin();
+    pairDeltaEtaMax = pairAxis[1]->GetXmax();
+
+    sortedSecond.resize(jMax);
+    for (Int_t j = 0; j < jMax; j++) sortedSecond[j] = j;
+    std::stable_sort(sortedSecond.begin(), sortedSecond.end(), EtaOrder(secondEta.GetArray()));
+
+    secondPtBin.Set(jMax);
+    for (Int_t j = 0; j < jMax; j++) secondPtBin[j] = pairAxis[4]->FindBin(secondPt[j]);
+  }
   
   //TLorenzVector implementation for resonances
   TLorentzVector vectorMother, vectorDaughter[2];
@@ -512,8 +574,33 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     if(charge1 > 0)      fHistP->Fill(trackVariablesSingle,0,firstCorrection); //==========================correction
     else if(charge1 < 0) fHistN->Fill(trackVariablesSingle,0,firstCorrection);  //==========================correction
     
+    // range of the 2nd particle loop, and for the sorted pair loop the part of 
+    // the global bin from the trigger variables (< 0 if out of the axes)
+    Int_t jBegin = 0;
+    Int_t jEnd   = jMax;
+    Long64_t triggerBin = -1;
+    Int_t ptTriggerBin = 0, vertexZBin = 0;
+    if (fSortedPairLoop) {
+      jBegin = FirstDeltaEtaBelow(sortedSecond, secondEta.GetArray(), firstEta, pairDeltaEtaMax);
+      jEnd   = FirstDeltaEtaBelow(sortedSecond, secondEta.GetArray(), firstEta, pairDeltaEtaMin);
+
+      Int_t eventClassBin = pairAxis[0]->FindBin(trackVariablesSingle[0]);
+      ptTriggerBin = pairAxis[3]->FindBin(firstPt);
+      vertexZBin   = pairAxis[5]->FindBin(vertexZ);
+      if (eventClassBin >= 1 && eventClassBin <= pairNBins[0] &&
+	  ptTriggerBin  >= 1 && ptTriggerBin  <= pairNBins[3] &&
+	  vertexZBin    >= 1 && vertexZBin    <= pairNBins[5])
+	triggerBin = eventClassBin - 1;
+
+      for (Int_t k = 0; k < 2; k++) {
+	pairBins[k].clear();
+	pairWeights[k].clear();
+      }
+    }
+
     // 2nd particle loop
-    for(Int_t j = 0; j < jMax; j++) {   
+    for(Int_t jj = jBegin; jj < jEnd; jj++) {   
+      Int_t j = (fSortedPairLoop ? sortedSecond[jj] : jj);
 
       if(!particlesMixed && j == i) continue; // no auto correlations (only for non mixing)
 
@@ -611,24 +698,14 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 	    Float_t phi2rad = secondPhi[j];
 	    
 	    // check first boundaries to see if is worth to loop and find the minimum
-	    Float_t dphistar1 = GetDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, 0.8, bSign);
+	    Float_t dphistar1 = GetDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, fHBTCutMinRadius, bSign);
 	    Float_t dphistar2 = GetDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, 2.5, bSign);
 	    
 	    const Float_t kLimit = fHBTCutValue * 3;
 	    
-	    Float_t dphistarminabs = 1e5;
-	    //Float_t dphistarmin = 1e5;
-	    
 	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0 ) {
-	      for (Double_t rad=0.8; rad<2.51; rad+=0.01) {
-		Float_t dphistar = GetDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, rad, bSign);
-		Float_t dphistarabs = TMath::Abs(dphistar);
-		
-		if (dphistarabs < dphistarminabs) {
-		  //dphistarmin = dphistar;
-		  dphistarminabs = dphistarabs;
-		}
-	      }
+	      // minimum over the radii fHBTCutMinRadius, ..., 2.5 in steps of 0.01
+	      Float_t dphistarminabs = TMath::Abs(fDPhiStar.GetMinDPhiStar(phi1rad, firstPt, charge1, phi2rad, secondPt[j], charge2, bSign));
 	      
 	      if (dphistarminabs < fHBTCutValue && TMath::Abs(deta) < fHBTCutValue) {
 		//AliInfo(Form("HBT: Removed track pair %d %d with [[%f %f]] %f %f %f | %f %f %d %f %f %d %f", i, j, deta, dphi, dphistarminabs, dphistar1, dphistar2, phi1rad, pt1, charge1, phi2rad, pt2, charge2, bSign));
@@ -689,6 +766,28 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 
       }
 
+      if (fSortedPairLoop) {
+	if (charge1 == 0 || charge2 == 0 || triggerBin < 0) continue;
+	Int_t deltaEtaBin = pairAxis[1]->FindBin(trackVariablesPair[1]);
+	Int_t deltaPhiBin = pairAxis[2]->FindBin(trackVariablesPair[2]);
+	Int_t ptAssocBin  = secondPtBin[j];
+	if (deltaEtaBin < 1 || deltaEtaBin > pairNBins[1] ||
+	    deltaPhiBin < 1 || deltaPhiBin > pairNBins[2] ||
+	    ptAssocBin  < 1 || ptAssocBin  > pairNBins[4])
+	  continue;
+	// same as AliTHn::GetGlobalBinIndex
+	Long64_t bin = triggerBin;
+	bin = bin * pairNBins[1] + deltaEtaBin - 1;
+	bin = bin * pairNBins[2] + deltaPhiBin - 1;
+	bin = bin * pairNBins[3] + ptTriggerBin - 1;
+	bin = bin * pairNBins[4] + ptAssocBin - 1;
+	bin = bin * pairNBins[5] + vertexZBin - 1;
+	Int_t k = (charge2 > 0 ? 0 : 1);
+	pairBins[k].push_back(bin);
+	pairWeights[k].push_back(firstCorrection*secondCorrection[j]);
+	continue;
+      }
+
       if( charge1 > 0 && charge2 < 0)  fHistPN->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]); //==========================correction
       else if( charge1 < 0 && charge2 > 0)  fHistNP->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
       else if( charge1 > 0 && charge2 > 0)  fHistPP->Fill(trackVariablesPair,0,firstCorrection*secondCorrection[j]);//==========================correction 
@@ -698,6 +797,16 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
 	continue;
       }
     }//end of 2nd particle loop
+
+    // batched fills of the sorted pair loop
+    if (fSortedPairLoop && charge1 != 0) {
+      AliTHn* histPos = (charge1 > 0) ? fHistPP : fHistNP;
+      AliTHn* histNeg = (charge1 > 0) ? fHistPN : fHistNN;
+      if (!pairBins[0].empty())
+	histPos->FillBins(pairBins[0].size(), &pairBins[0][0], 0, &pairWeights[0][0]);
+      if (!pairBins[1].empty())
+	histNeg->FillBins(pairBins[1].size(), &pairBins[1][0], 0, &pairWeights[1][0]);
+    }
   }//end of 1st particle loop
 }  
 
@@ -2738,28 +2847,12 @@ Bool_t AliBalancePsi::GetMomentsAnalytical(Int_t fVariable, TH1D* gHist, Bool_t
 
 
 //____________________________________________________________________//
-Float_t AliBalancePsi::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign) { 
+Float_t AliBalancePsi::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign) {
   //
   // calculates dphistar
   //
-  Float_t dphistar = phi1 - phi2 - charge1 * bSign * TMath::ASin(0.075 * radius / pt1) + charge2 * bSign * TMath::ASin(0.075 * radius / pt2);
-  
-  static const Double_t kPi = TMath::Pi();
-  
-  // circularity
-//   if (dphistar > 2 * kPi)
-//     dphistar -= 2 * kPi;
-//   if (dphistar < -2 * kPi)
-//     dphistar += 2 * kPi;
-  
-  if (dphistar > kPi)
-    dphistar = kPi * 2 - dphistar;
-  if (dphistar < -kPi)
-    dphistar = -kPi * 2 - dphistar;
-  if (dphistar > kPi) // might look funny but is needed
-    dphistar = kPi * 2 - dphistar;
-  
-  return dphistar;
+
+  return AliTwoTrackDPhiStar::GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, radius, bSign);
 }
 
 //____________________________________________________________________//
@@ -17,6 +17,8 @@
 #include "TString.h"
 #include "TH2D.h"
 
+#include "AliTwoTrackDPhiStar.h"
+
 #include "AliTHn.h"
 
 using std::vector;
@@ -227,10 +229,15 @@ class AliBalancePsi : public TObject {
   void UseResonancesCut() {fResonancesCut = kTRUE;}
   void UseHBTCut(Double_t setHBTCutValue = 0.02) {
     fHBTCut = kTRUE; fHBTCutValue = setHBTCutValue;}
+  void SetHBTCutMinRadius(Float_t min) {fHBTCutMinRadius = min;}
   void UseConversionCut(Double_t setInvMassCutConversion = 0.04) {
     fConversionCut = kTRUE; fInvMassCutConversion = setInvMassCutConversion; }
   void UseMomentumDifferenceCut(Double_t gDeltaPtCutMin) {
     fQCut = kTRUE; fDeltaPtMin = gDeltaPtCutMin;}
+  // loop only over the pairs inside the Delta eta axis, with the associated
+  // particles sorted in eta, and fill the pair histograms by precomputed bins
+  // (same entries, but the pair cut QA histograms only see these pairs)
+  void UseSortedPairLoop(Bool_t sortedPairLoop = kTRUE) {fSortedPairLoop = sortedPairLoop;}
 
   // related to customized binning of output AliTHn
   Bool_t    IsUseVertexBinning() { return fVertexBinning; }
@@ -278,11 +285,14 @@ class AliBalancePsi : public TObject {
   Bool_t fResonancesCut;//resonances cut
   Bool_t fHBTCut;//cut for two-track efficiency (like HBT group)
   Double_t fHBTCutValue;// value for two-track efficiency cut (default = 0.02 from dphicorrelations)
+  Float_t fHBTCutMinRadius;// min radius of the dphi* scan of the two-track efficiency cut
+  AliTwoTrackDPhiStar fDPhiStar;//! dphi* scan of the two-track efficiency cut
   Bool_t fConversionCut;//conversion cut
   Double_t fInvMassCutConversion;//invariant mass for conversion cut
   Bool_t fQCut;//cut on momentum difference to suppress femtoscopic effect correlations
   Double_t fDeltaPtMin;//delta pt cut: minimum value
   Bool_t fVertexBinning;//use vertex z binning in AliTHn
+  Bool_t fSortedPairLoop;//loop over eta sorted pairs inside the Delta eta axis only
   TString fCustomBinning;//for setting customized binning
   TString fBinningString;//final binning string
 
@@ -290,7 +300,7 @@ class AliBalancePsi : public TObject {
 
   AliBalancePsi & operator=(const AliBalancePsi & ) {return *this;}
 
-  ClassDef(AliBalancePsi, 2)
+  ClassDef(AliBalancePsi, 4)
 };
 
 #endif
@@ -117,14 +117,17 @@ bool AliFemtoPairCutRadialDistance::Pass(const AliFemtoPair* pair){
   rad = fMinRad;
 
   if (fPhistarmin) {
-    for (rad = fMinRad; rad < fMaxRad; rad += 0.01) {
-      Double_t dps = (phi2-phi1+(TMath::ASin(-0.075*chg2*fMagSign*rad/ptv2))-(TMath::ASin(-0.075*chg1*fMagSign*rad/ptv1)));
-      dps = TVector2::Phi_mpi_pi(dps);
-      Double_t etad = eta2 - eta1;
-      if (fabs(etad)<fEtaMin && fabs(dps)<fDPhiStarMin) {
-        // cout << "5% cut is not passed - returning" << endl;
-        pass5 = kFALSE;
-        break;
+    // the eta condition does not depend on the radius: scan only pairs close in eta
+    Double_t etad = eta2 - eta1;
+    if (fabs(etad)<fEtaMin) {
+      for (rad = fMinRad; rad < fMaxRad; rad += 0.01) {
+        Double_t dps = (phi2-phi1+(TMath::ASin(-0.075*chg2*fMagSign*rad/ptv2))-(TMath::ASin(-0.075*chg1*fMagSign*rad/ptv1)));
+        dps = TVector2::Phi_mpi_pi(dps);
+        if (fabs(dps)<fDPhiStarMin) {
+          // cout << "5% cut is not passed - returning" << endl;
+          pass5 = kFALSE;
+          break;
+        }
       }
     }
   }
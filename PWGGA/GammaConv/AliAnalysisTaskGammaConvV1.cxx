@@ -571,6 +571,7 @@ void AliAnalysisTaskGammaConvV1::InitBack(){
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->GetNumberOfBGEvents(),
                                   ((AliConversionMesonCuts*)fMesonCutArray->At(iCut))->UseTrackMultiplicity(),
                                   0,8,5);
+        fBGHandler[iCut]->SetUseFlatPhotonPool();
         fBGHandlerRP[iCut] = NULL;
       } else {
         fBGHandlerRP[iCut] = new AliConversionAODBGHandlerRP(
@@ -3436,15 +3437,16 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
 
     if(((AliConversionMesonCuts*)fMesonCutArray->At(fiCut))->UseTrackMultiplicity()){
       for(Int_t nEventsInBG=0;nEventsInBG<fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
+        Int_t nPreviousEventV0s = fBGHandler[fiCut]->GetNBGPhotons(zbin,mbin,nEventsInBG);
         if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
           bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
         }
 
         for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
         AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-        for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
-          AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+        AliAODConversionPhoton previousGoodV0;
+        for(Int_t iPrevious=0;iPrevious<nPreviousEventV0s;iPrevious++){
+          fBGHandler[fiCut]->GetBGPhoton(zbin,mbin,nEventsInBG,iPrevious,&previousGoodV0);
           if(fMoveParticleAccordingToVertex == kTRUE){
             MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
           }
@@ -3471,16 +3473,17 @@ void AliAnalysisTaskGammaConvV1::CalculateBackground(){
       }
     } else {
       for(Int_t nEventsInBG=0;nEventsInBG <fBGHandler[fiCut]->GetNBGEvents();nEventsInBG++){
-        AliGammaConversionAODVector *previousEventV0s = fBGHandler[fiCut]->GetBGGoodV0s(zbin,mbin,nEventsInBG);
-        if(previousEventV0s){
+        Int_t nPreviousEventV0s = fBGHandler[fiCut]->GetNBGPhotons(zbin,mbin,nEventsInBG);
+        if(nPreviousEventV0s){
         if(fMoveParticleAccordingToVertex == kTRUE || ((AliConversionPhotonCuts*)fCutArray->At(fiCut))->GetInPlaneOutOfPlaneCut() != 0){
           bgEventVertex = fBGHandler[fiCut]->GetBGEventVertex(zbin,mbin,nEventsInBG);
         }
         for(Int_t iCurrent=0;iCurrent<fGammaCandidates->GetEntries();iCurrent++){
           AliAODConversionPhoton currentEventGoodV0 = *(AliAODConversionPhoton*)(fGammaCandidates->At(iCurrent));
-          for(Int_t iPrevious=0;iPrevious<previousEventV0s->size();iPrevious++){
+          AliAODConversionPhoton previousGoodV0;
+          for(Int_t iPrevious=0;iPrevious<nPreviousEventV0s;iPrevious++){
 
-            AliAODConversionPhoton previousGoodV0 = (AliAODConversionPhoton)(*(previousEventV0s->at(iPrevious)));
+            fBGHandler[fiCut]->GetBGPhoton(zbin,mbin,nEventsInBG,iPrevious,&previousGoodV0);
 
             if(fMoveParticleAccordingToVertex == kTRUE){
               MoveParticleAccordingToVertex(&previousGoodV0,bgEventVertex);
@@ -44,7 +44,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler() :
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(),
 	fBGEventsENeg(),
-	fBGEventsMeson()
+	fBGEventsMeson(),
+	fUseFlatPhotonPool(kFALSE),
+	fFlatPhotonPool()
 {
 	// constructor
 }
@@ -64,7 +66,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t binsZ,Int_t
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseFlatPhotonPool(kFALSE),
+	fFlatPhotonPool()
 {
 	// constructor
 }
@@ -86,7 +90,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(Int_t collisionSy
 	fBinLimitsArrayMultiplicity(NULL),
 	fBGEvents(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
 	fBGEventsENeg(binsZ,AliGammaConversionMultipicityVector(binsMultiplicity,AliGammaConversionBGEventVector(nEvents))),
-	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents)))
+	fBGEventsMeson(binsZ,AliGammaConversionMotherMultipicityVector(binsMultiplicity,AliGammaConversionMotherBGEventVector(nEvents))),
+	fUseFlatPhotonPool(kFALSE),
+	fFlatPhotonPool()
 {
 	// constructor
     if(fNBinsZ>8) fNBinsZ = 8;
@@ -357,7 +363,9 @@ AliGammaConversionAODBGHandler::AliGammaConversionAODBGHandler(const AliGammaCon
 	fBinLimitsArrayMultiplicity(original.fBinLimitsArrayMultiplicity),
 	fBGEvents(original.fBGEvents),
 	fBGEventsENeg(original.fBGEventsENeg),
-	fBGEventsMeson(original.fBGEventsMeson)
+	fBGEventsMeson(original.fBGEventsMeson),
+	fUseFlatPhotonPool(original.fUseFlatPhotonPool),
+	fFlatPhotonPool(original.fFlatPhotonPool)
 {
 	//copy constructor	
 }
@@ -583,6 +591,26 @@ void AliGammaConversionAODBGHandler::AddEvent(TList* const eventGammas,Double_t
 	fBGEventVertex[z][m][eventCounter].fZ = zvalue;
 	fBGEventVertex[z][m][eventCounter].fEP = epvalue;
 
+	if(fUseFlatPhotonPool){
+		// overwrite the records of the slot, its memory is reused
+		vector<Double_t> &records = fFlatPhotonPool[GetFlatPoolSlot(z,m,eventCounter)];
+		records.resize(eventGammas->GetEntries()*kPoolNVar);
+		for(Int_t i=0; i< eventGammas->GetEntries();i++){
+			AliAODConversionPhoton *gamma = (AliAODConversionPhoton*)(eventGammas->At(i));
+			Double_t *record = &records[i*kPoolNVar];
+			record[kPoolPx] = gamma->Px();
+			record[kPoolPy] = gamma->Py();
+			record[kPoolPz] = gamma->Pz();
+			record[kPoolE] = gamma->E();
+			record[kPoolConvX] = gamma->GetConversionX();
+			record[kPoolConvY] = gamma->GetConversionY();
+			record[kPoolConvZ] = gamma->GetConversionZ();
+			record[kPoolQuality] = gamma->GetPhotonQuality();
+		}
+		fBGEventCounter[z][m]++;
+		return;
+	}
+
 	//first clear the vector
 	// cout<<"Size of vector: "<<fBGEvents[z][m][eventCounter].size()<<endl;
 	//  cout<<"Checking the entries: Z="<<z<<", M="<<m<<", eventCounter="<<eventCounter<<endl;
@@ -669,6 +697,50 @@ AliGammaConversionAODVector* AliGammaConversionAODBGHandler::GetBGGoodV0s(Int_t
 	return &(fBGEvents[zbin][mbin][event]);
 }
 
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::SetUseFlatPhotonPool(Bool_t useFlatPool){
+	//see headerfile for documentation
+	fUseFlatPhotonPool = useFlatPool;
+	fFlatPhotonPool.clear();
+	if(fUseFlatPhotonPool) fFlatPhotonPool.resize(fNBinsZ*fNBinsMultiplicity*fNEvents);
+}
+
+//_____________________________________________________________________________________________________________________________
+Int_t AliGammaConversionAODBGHandler::GetNBGPhotons(Int_t zbin, Int_t mbin, Int_t event){
+	//see headerfile for documentation
+	if(fUseFlatPhotonPool) return fFlatPhotonPool[GetFlatPoolSlot(zbin,mbin,event)].size()/kPoolNVar;
+	return fBGEvents[zbin][mbin][event].size();
+}
+
+//_____________________________________________________________________________________________________________________________
+const Double_t* AliGammaConversionAODBGHandler::GetBGPhotonKinematics(Int_t zbin, Int_t mbin, Int_t event){
+	//see headerfile for documentation
+	if(!fUseFlatPhotonPool) return NULL;
+	const vector<Double_t> &records = fFlatPhotonPool[GetFlatPoolSlot(zbin,mbin,event)];
+	return records.empty() ? NULL : &records[0];
+}
+
+//_____________________________________________________________________________________________________________________________
+void AliGammaConversionAODBGHandler::GetBGPhoton(Int_t zbin, Int_t mbin, Int_t event, Int_t iPhoton, AliAODConversionPhoton* photon){
+	//see headerfile for documentation
+	Double_t convPoint[3];
+	if(fUseFlatPhotonPool){
+		const Double_t *record = &fFlatPhotonPool[GetFlatPoolSlot(zbin,mbin,event)][iPhoton*kPoolNVar];
+		photon->SetPxPyPzE(record[kPoolPx],record[kPoolPy],record[kPoolPz],record[kPoolE]);
+		convPoint[0] = record[kPoolConvX];
+		convPoint[1] = record[kPoolConvY];
+		convPoint[2] = record[kPoolConvZ];
+		photon->SetConversionPoint(convPoint);
+		photon->SetPhotonQuality((UChar_t)record[kPoolQuality]);
+		return;
+	}
+	AliAODConversionPhoton *gamma = fBGEvents[zbin][mbin][event][iPhoton];
+	photon->SetPxPyPzE(gamma->Px(),gamma->Py(),gamma->Pz(),gamma->E());
+	gamma->GetConversionPoint(convPoint);
+	photon->SetConversionPoint(convPoint);
+	photon->SetPhotonQuality(gamma->GetPhotonQuality());
+}
+
 //_____________________________________________________________________________________________________________________________
 AliGammaConversionMotherAODVector* AliGammaConversionAODBGHandler::GetBGGoodMesons(Int_t zbin, Int_t mbin, Int_t event){
 	//see headerfile for documentation
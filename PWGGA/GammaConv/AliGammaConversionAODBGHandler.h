@@ -47,6 +47,9 @@ class AliGammaConversionAODBGHandler : public TObject {
 	typedef vector<AliGammaConversionMotherAODVector> AliGammaConversionMotherBGEventVector;
 	typedef vector<AliGammaConversionMotherBGEventVector> AliGammaConversionMotherMultipicityVector;
 	typedef vector<AliGammaConversionMotherMultipicityVector> AliGammaConversionMotherBGVector;
+
+	// variables of the photon records in the flat pool
+	enum EFlatPoolVariable { kPoolPx=0, kPoolPy, kPoolPz, kPoolE, kPoolConvX, kPoolConvY, kPoolConvZ, kPoolQuality, kPoolNVar };
 	
 	AliGammaConversionAODBGHandler();																							//constructor
     AliGammaConversionAODBGHandler(Int_t binsZ,Int_t binsMultiplicity,Int_t nEvents);										// constructor
@@ -71,6 +74,16 @@ class AliGammaConversionAODBGHandler : public TObject {
 	AliGammaConversionAODVector* GetBGGoodV0s(Int_t zbin, Int_t mbin, Int_t event);
 	// Get BG mesons
 	AliGammaConversionMotherAODVector* GetBGGoodMesons(Int_t zbin, Int_t mbin, Int_t event);
+
+	// Flat photon pool: only the kinematics needed for the mixing (kPoolNVar values per photon)
+	// are kept, in one array per (z, mult, event) slot that is reused when the pool rolls over.
+	// Has to be switched on before the first event is added; GetBGGoodV0s is then empty.
+	void SetUseFlatPhotonPool(Bool_t useFlatPool = kTRUE);
+	Bool_t GetUseFlatPhotonPool() const {return fUseFlatPhotonPool;}
+	Int_t GetNBGPhotons(Int_t zbin, Int_t mbin, Int_t event);
+	const Double_t* GetBGPhotonKinematics(Int_t zbin, Int_t mbin, Int_t event);
+	// Set momentum, conversion point and quality of photon to the ones of a BG photon (both pool types)
+	void GetBGPhoton(Int_t zbin, Int_t mbin, Int_t event, Int_t iPhoton, AliAODConversionPhoton* photon);
 	// Get BG electron
 	AliGammaConversionAODVector* GetBGGoodENeg(Int_t event, Double_t zvalue, Int_t multiplicity);
 	
@@ -81,6 +94,7 @@ class AliGammaConversionAODBGHandler : public TObject {
 	Double_t GetBGProb(Int_t z, Int_t m){return fBGProbability[z][m];}
 
 	private:
+		Int_t GetFlatPoolSlot(Int_t zbin, Int_t mbin, Int_t event) const {return (zbin*fNBinsMultiplicity+mbin)*fNEvents+event;}
 
 		Int_t 								fNEvents; 						// number of events
 		Int_t ** 							fBGEventCounter;				//! bg counter
@@ -95,7 +109,9 @@ class AliGammaConversionAODBGHandler : public TObject {
 		AliGammaConversionBGVector 			fBGEvents; 						// photon background events
 		AliGammaConversionBGVector 			fBGEventsENeg; 					// electron background electron events
 		AliGammaConversionMotherBGVector 	fBGEventsMeson; 				// neutral meson background events
+		Bool_t								fUseFlatPhotonPool;				//! store the photons in the flat pool
+		vector< vector<Double_t> >			fFlatPhotonPool;				//! photon records per (z, mult, event) slot
 		
-	ClassDef(AliGammaConversionAODBGHandler,5)
+	ClassDef(AliGammaConversionAODBGHandler,6)
 };
 #endif
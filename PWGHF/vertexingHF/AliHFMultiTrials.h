@@ -7,6 +7,7 @@
 #include <TString.h>
 #include <TPad.h>
 #include <set>
+#include <vector>
 
 class TNtuple;
 
@@ -84,6 +85,16 @@ class AliHFMultiTrials : public TNamed {
 
   void SetDrawIndividualFits(Bool_t opt=kTRUE){fDrawIndividualFits=opt;}
 
+  /// initialise mean and sigma of each fit from the closest converged trial
+  /// (same rebin, background and fit configuration, neighbouring fit range)
+  void SetUseWarmStart(Bool_t opt=kTRUE){fUseWarmStart=opt;}
+  /// run only the trials with index%nSubsets==iSubset, to spread the trial grid
+  /// over several processes: the outputs are filled in the same bins and can be merged
+  void SetTrialSubset(Int_t iSubset, Int_t nSubsets){
+    fSubset=iSubset;
+    fNumOfSubsets=nSubsets>0 ? nSubsets : 1;
+  }
+
   Bool_t DoMultiTrials(TH1D* hInvMassHisto, TPad* thePad=0x0);
   void SaveToRoot(TString fileName, TString option="recreate") const;
   void DrawHistos(TCanvas* cry) const;
@@ -100,6 +111,22 @@ class AliHFMultiTrials : public TNamed {
 
  private:
 
+  /// one point of the trial grid
+  struct TrialConfig {
+    TrialConfig() : fRebinStep(0), fFirstBin(1), fLowLimStep(0), fUpLimStep(0), fBkgFunc(0), fFitConf(0), fTrial(0), fMean(0.), fSigma(0.) {}
+    Int_t fRebinStep;     /// index in fRebinSteps
+    Int_t fFirstBin;      /// first bin used for rebin
+    Int_t fLowLimStep;    /// index in fLowLimFitSteps
+    Int_t fUpLimStep;     /// index in fUpLimFitSteps
+    Int_t fBkgFunc;       /// EBkgFuncCases
+    Int_t fFitConf;       /// EFitParamCases
+    Int_t fTrial;         /// trial number within the bkg/fit configuration
+    Double_t fMean;       /// fitted mean (converged trials)
+    Double_t fSigma;      /// fitted sigma (converged trials)
+  };
+
+  Int_t BuildTrialGrid(std::vector<TrialConfig>& grid) const;
+  const TrialConfig* FindWarmStart(const TrialConfig& trial, const std::vector<TrialConfig>& converged) const;
   Bool_t CreateHistos();
   TH1F* RebinHisto(TH1D* hOrig, Int_t reb, Int_t firstUse) const;
   void BinCount(TH1F* h, TF1* fB, Int_t rebin, Double_t minMass, Double_t maxMass, Double_t& count, Double_t& ecount) const;
@@ -175,8 +202,12 @@ class AliHFMultiTrials : public TNamed {
   Double_t fMinYieldGlob;   /// minimum yield
   Double_t fMaxYieldGlob;   /// maximum yield
 
+  Bool_t fUseWarmStart;     /// flag for initialising the fits from converged neighbours
+  Int_t fNumOfSubsets;      /// number of subsets the trial grid is split into
+  Int_t fSubset;            /// subset of trials processed
+
   /// \cond CLASSIMP
-  ClassDef(AliHFMultiTrials,5); /// class for multiple trials of invariant mass fit
+  ClassDef(AliHFMultiTrials,6); /// class for multiple trials of invariant mass fit
   /// \endcond
 };
 
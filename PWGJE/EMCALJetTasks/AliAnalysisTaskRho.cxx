@@ -79,8 +79,7 @@ Bool_t AliAnalysisTaskRho::Run()
     }
   }
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
+  fRhoVec.clear();
 
   // push all jets within selected acceptance into stack
   for (Int_t iJets = 0; iJets < Njets; ++iJets) {
@@ -98,14 +97,13 @@ Bool_t AliAnalysisTaskRho::Run()
     if (!AcceptJet(jet))
       continue;
 
-    rhovec[NjetAcc] = jet->Pt() / jet->Area();
-    ++NjetAcc;
+    fRhoVec.push_back(jet->Pt() / jet->Area());
   }
 
 
-  if (NjetAcc > 0) {
+  if (!fRhoVec.empty()) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = TMath::Median(fRhoVec.size(), fRhoVec.data());
     fOutRho->SetVal(rho);
 
     if (fOutRhoScaled) {
@@ -40,6 +40,7 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase() :
   fOutRhoScaled(0),
   fCompareRho(0),
   fCompareRhoScaled(0),
+  fRhoVec(),
   fHistJetPtvsCent(0),
   fHistJetAreavsCent(0),
   fHistJetRhovsCent(0),
@@ -85,6 +86,7 @@ AliAnalysisTaskRhoBase::AliAnalysisTaskRhoBase(const char *name, Bool_t histo) :
   fOutRhoScaled(0),
   fCompareRho(0),
   fCompareRhoScaled(0),
+  fRhoVec(),
   fHistJetPtvsCent(0),
   fHistJetAreavsCent(0),
   fHistJetRhovsCent(0),
@@ -10,6 +10,8 @@ class TH2F;
 class TH3F;
 class AliRhoParameter;
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcalJet.h"
 
 class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
@@ -56,6 +58,7 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   AliRhoParameter       *fOutRhoScaled;                  //!output scaled rho object
   AliRhoParameter       *fCompareRho;                    //!rho object to compare
   AliRhoParameter       *fCompareRhoScaled;              //!scaled rho object to compare
+  std::vector<Double_t>  fRhoVec;                        //!per-jet (or per-particle) values of the current event
 
   TH2F                  *fHistJetPtvsCent;               //!jet pt vs. centrality
   TH2F                  *fHistJetAreavsCent;             //!jet area vs. centrality
@@ -83,6 +86,6 @@ class AliAnalysisTaskRhoBase : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskRhoBase(const AliAnalysisTaskRhoBase&);             // not implemented
   AliAnalysisTaskRhoBase& operator=(const AliAnalysisTaskRhoBase&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoBase, 11); // Rho base task
+  ClassDef(AliAnalysisTaskRhoBase, 12); // Rho base task
 };
 #endif
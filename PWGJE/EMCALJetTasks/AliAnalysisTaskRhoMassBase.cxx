@@ -34,6 +34,7 @@ AliAnalysisTaskRhoMassBase::AliAnalysisTaskRhoMassBase() :
   fOutRhoMassScaled(0),
   fCompareRhoMass(0),
   fCompareRhoMassScaled(0),
+  fRhoMassVec(),
   fHistJetMassvsCent(0),
   fHistRhoMassvsCent(0),
   fHistRhoMassScaledvsCent(0),
@@ -64,6 +65,7 @@ AliAnalysisTaskRhoMassBase::AliAnalysisTaskRhoMassBase(const char *name, Bool_t
   fOutRhoMassScaled(0),
   fCompareRhoMass(0),
   fCompareRhoMassScaled(0),
+  fRhoMassVec(),
   fHistJetMassvsCent(0),
   fHistRhoMassvsCent(0),
   fHistRhoMassScaledvsCent(0),
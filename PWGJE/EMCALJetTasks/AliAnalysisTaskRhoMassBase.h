@@ -9,6 +9,8 @@ class TH1F;
 class TH2F;
 class AliRhoParameter;
 
+#include <vector>
+
 #include "AliAnalysisTaskEmcalJet.h"
 
 class AliAnalysisTaskRhoMassBase : public AliAnalysisTaskEmcalJet {
@@ -53,6 +55,7 @@ class AliAnalysisTaskRhoMassBase : public AliAnalysisTaskEmcalJet {
   AliRhoParameter       *fOutRhoMassScaled;              //!output scaled rho object
   AliRhoParameter       *fCompareRhoMass;                //!rho object to compare
   AliRhoParameter       *fCompareRhoMassScaled;          //!scaled rho object to compare
+  std::vector<Double_t>  fRhoMassVec;                    //!per-jet rho mass values of the current event
 
   TH2F                  *fHistJetMassvsCent;             //!jet mass vs. centrality
   TH2F                  *fHistRhoMassvsCent;             //!rho mass vs. centrality
@@ -73,6 +76,6 @@ class AliAnalysisTaskRhoMassBase : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskRhoMassBase(const AliAnalysisTaskRhoMassBase&);             // not implemented
   AliAnalysisTaskRhoMassBase& operator=(const AliAnalysisTaskRhoMassBase&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoMassBase, 2); // Rho mass base task
+  ClassDef(AliAnalysisTaskRhoMassBase, 3); // Rho mass base task
 };
 #endif
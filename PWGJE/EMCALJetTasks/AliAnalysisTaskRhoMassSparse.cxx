@@ -137,10 +137,9 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     }
   }
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
-  Int_t NjetAcc = 0;
+  fRhoMassVec.clear();
+  Double_t sumJetE = 0.;
+  Double_t sumJetM = 0.;
   Double_t TotaljetArea=0;
   Double_t TotaljetAreaPhys=0;
 
@@ -194,11 +193,11 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     if(jet->Area()>0.) {// && (jet->M()*jet->M() + jet->Pt()*jet->Pt())>0.) {
        //rhomvec[NjetAcc] = (TMath::Sqrt(sumM*sumM + sumPt*sumPt) - sumPt ) / jet->Area();
       // rhomvec[NjetAcc] = (TMath::Sqrt(jet->M()*jet->M() + jet->Pt()*jet->Pt()) - jet->Pt() ) / jet->Area();
-      rhomvec[NjetAcc] = GetMd(jet) / jet->Area();
-      fHistMdAreavsCent->Fill(fCent,rhomvec[NjetAcc]);
-      Evec[NjetAcc] = jet->E();
-      Mvec[NjetAcc] = jet->M();
-      ++NjetAcc;
+      Double_t rhomJet = GetMd(jet) / jet->Area();
+      fHistMdAreavsCent->Fill(fCent,rhomJet);
+      fRhoMassVec.push_back(rhomJet);
+      sumJetE += jet->E();
+      sumJetM += jet->M();
     }
   }
 
@@ -209,9 +208,10 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     fHistOccCorrvsCent->Fill(fCent, OccCorr);
 
 
+  const Int_t NjetAcc = fRhoMassVec.size();
   if (NjetAcc > 0) {
     //find median value
-    Double_t rhom = TMath::Median(NjetAcc, rhomvec);
+    Double_t rhom = TMath::Median(NjetAcc, fRhoMassVec.data());
     if(fRhoCMS){
       rhom = rhom * OccCorr;
     }
@@ -219,8 +219,8 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     fOutRhoMass->SetVal(rhom);
 
     Int_t Ntracks = fTracks->GetEntries();
-    Double_t meanM = TMath::Mean(NjetAcc, Mvec);
-    Double_t meanE = TMath::Mean(NjetAcc, Evec);
+    Double_t meanM = sumJetM / NjetAcc;
+    Double_t meanE = sumJetE / NjetAcc;
     Double_t gamma = 0.;
     if(meanM>0.) gamma = meanE/meanM;
     fHistGammaVsNtrack->Fill(Ntracks,gamma);
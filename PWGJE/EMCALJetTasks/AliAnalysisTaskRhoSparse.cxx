@@ -126,8 +126,7 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
     }
   }
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
+  fRhoVec.clear();
   Double_t TotaljetArea=0;
   Double_t TotaljetAreaPhys=0;
 
@@ -176,8 +175,7 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
       continue;
 
     if(jet->Pt()>0.1){
-      rhovec[NjetAcc] = jet->Pt() / jet->Area();
-      ++NjetAcc;
+      fRhoVec.push_back(jet->Pt() / jet->Area());
     }
   }
 
@@ -187,9 +185,9 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
   if (fCreateHisto)
     fHistOccCorrvsCent->Fill(fCent, OccCorr);
 
-  if (NjetAcc > 0) {
+  if (!fRhoVec.empty()) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = TMath::Median(fRhoVec.size(), fRhoVec.data());
 
     if(fRhoCMS){
       rho = rho * OccCorr;
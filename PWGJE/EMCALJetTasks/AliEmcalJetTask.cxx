@@ -76,6 +76,7 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fIsEmcPart(0),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fFillConstituentKinematics(kFALSE),
   fJets(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap(),
@@ -111,6 +112,7 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fIsEmcPart(0),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fFillConstituentKinematics(kFALSE),
   fJets(0),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap(),
@@ -441,6 +443,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
 
   jet->SetNumberOfTracks(constituents.size());
   jet->SetNumberOfClusters(constituents.size());
+  if (fFillConstituentKinematics) jet->ClearConstituentKinematics();
 
   for (UInt_t ic = 0; ic < constituents.size(); ++ic) {
 
@@ -522,6 +525,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
 
       if (flag == 0 || particlesSubName == "") {
         jet->AddTrackAt(fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, tid), nt);
+        if (fFillConstituentKinematics) jet->AddConstituentKinematics(AliEmcalJet::kTrackConstituent, nt, cPt, cEta, t->Phi(), t->M());
       }
       else {
         // Get the particle container and array corresponding to the subtracted particles
@@ -532,6 +536,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
         AliEmcalParticle* part_sub = new ((*particles_sub)[part_sub_id]) AliEmcalParticle(dynamic_cast<AliVTrack*>(t));   // SA: probably need to be fixed!!
         part_sub->SetPtEtaPhiM(constituents[ic].perp(),constituents[ic].eta(),constituents[ic].phi(),constituents[ic].m());
         jet->AddTrackAt(fParticleContainerIndexMap.GlobalIndexFromLocalIndex(partCont, part_sub_id), nt);
+        if (fFillConstituentKinematics) jet->AddConstituentKinematics(AliEmcalJet::kTrackConstituent, nt, part_sub->Pt(), part_sub->Eta(), part_sub->Phi(), part_sub->M());
       }
 
       ++nt;
@@ -572,6 +577,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
 
       if (flag == 0 || particlesSubName == "") {
         jet->AddClusterAt(fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, cid), nc);
+        if (fFillConstituentKinematics) jet->AddConstituentKinematics(AliEmcalJet::kClusterConstituent, nc, cPt, cEta, nP.Phi_0_2pi(), nP.M());
       }
       else {
         // Get the cluster container and array corresponding to the subtracted particles
@@ -582,6 +588,7 @@ void AliEmcalJetTask::FillJetConstituents(AliEmcalJet *jet, std::vector<fastjet:
         AliEmcalParticle* part_sub = new ((*particles_sub)[part_sub_id]) AliEmcalParticle(c);
         part_sub->SetPtEtaPhiM(constituents[ic].perp(),constituents[ic].eta(),constituents[ic].phi(),constituents[ic].m());
         jet->AddClusterAt(fClusterContainerIndexMap.GlobalIndexFromLocalIndex(clusCont, part_sub_id), nc);
+        if (fFillConstituentKinematics) jet->AddConstituentKinematics(AliEmcalJet::kClusterConstituent, nc, part_sub->Pt(), part_sub->Eta(), part_sub->Phi(), part_sub->M());
       }
 
       ++nc;
@@ -78,6 +78,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   void                   SetTrackEfficiencyOnlyForEmbedding(Bool_t b) { if (IsLocked()) return; fTrackEfficiencyOnlyForEmbedding = b     ; }
   void                   SetLegacyMode(Bool_t mode)                 { if (IsLocked()) return; fLegacyMode       = mode  ; }
   void                   SetFillGhost(Bool_t b=kTRUE)               { if (IsLocked()) return; fFillGhost        = b     ; }
+  void                   SetFillConstituentKinematics(Bool_t b=kTRUE) { if (IsLocked()) return; fFillConstituentKinematics = b; }
   void                   SetRadius(Double_t r)                      { if (IsLocked()) return; fRadius           = r     ; }
 
   void                   SetEtaRange(Double_t emi, Double_t ema);
@@ -180,6 +181,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   Bool_t                 fIsEmcPart;              //!=true if emcal particles are given as input (for clusters)
   Bool_t                 fLegacyMode;             //!=true to enable FJ 2.x behavior
   Bool_t                 fFillGhost;              //!=true ghost particles will be filled in AliEmcalJet obj
+  Bool_t                 fFillConstituentKinematics; // =true pt-sorted constituent kinematics will be filled in AliEmcalJet obj
 
   TClonesArray          *fJets;                   //!jet collection
   AliFJWrapper           fFastJetWrapper;         //!fastjet wrapper
@@ -197,7 +199,7 @@ class AliEmcalJetTask : public AliAnalysisTaskEmcal {
   AliEmcalJetTask &operator=(const AliEmcalJetTask&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalJetTask, 24);
+  ClassDef(AliEmcalJetTask, 25);
   /// \endcond
 };
 #endif
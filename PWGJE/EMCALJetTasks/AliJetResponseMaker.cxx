@@ -22,6 +22,9 @@
 #include <TClonesArray.h>
 #include <TH2F.h>
 #include <THnSparse.h>
+#include <TVector2.h>
+#include <algorithm>
+#include <vector>
 
 #include "AliTLorentzVector.h"
 #include "AliAnalysisManager.h"
@@ -37,6 +40,33 @@
 
 ClassImp(AliJetResponseMaker)
 
+namespace {
+  // particle-level jet constituent, entry of the label index of DoMCLabelMatchingLoop
+  struct LabelIndexEntry {
+    Int_t    fIndex; // particle index, as returned by AliEmcalJet::TrackAt
+    Int_t    fJet;   // position of the particle-level jet in the jet loop
+    Double_t fPt;    // pt of the particle
+    Bool_t operator<(const LabelIndexEntry& other) const { return fIndex < other.fIndex; }
+  };
+
+  // accumulate the pt of a detector-level constituent matched to particle index
+  void AddSharedPt(const std::vector<LabelIndexEntry>& index, std::vector<Int_t>& found, Int_t foundId,
+                   Int_t particle, Double_t pt1, Double_t frac, std::vector<Double_t>& shared1, std::vector<Double_t>& shared2)
+  {
+    LabelIndexEntry key;
+    key.fIndex = particle;
+    std::vector<LabelIndexEntry>::const_iterator it = std::lower_bound(index.begin(), index.end(), key);
+    for (; it != index.end() && it->fIndex == particle; ++it) {
+      shared1[it->fJet] += pt1;
+      Int_t k = it - index.begin();
+      if (found[k] != foundId) { // the particle-level pt is counted once, with the fraction of its first match
+        found[k] = foundId;
+        shared2[it->fJet] += it->fPt * frac;
+      }
+    }
+  }
+}
+
 //________________________________________________________________________
 AliJetResponseMaker::AliJetResponseMaker() : 
   AliAnalysisTaskEmcalJet("AliJetResponseMaker", kTRUE),
@@ -45,6 +75,7 @@ AliJetResponseMaker::AliJetResponseMaker() :
   fMatchingPar2(0),
   fUseCellsToMatch(kFALSE),
   fMinJetMCPt(1),
+  fFastMatching(kFALSE),
   fHistoType(0),
   fDeltaPtAxis(0),
   fDeltaEtaDeltaPhiAxis(0),
@@ -133,6 +164,7 @@ AliJetResponseMaker::AliJetResponseMaker(const char *name) :
   fMatchingPar2(0),
   fUseCellsToMatch(kFALSE),
   fMinJetMCPt(1),
+  fFastMatching(kFALSE),
   fHistoType(0),
   fDeltaPtAxis(0),
   fDeltaEtaDeltaPhiAxis(0),
@@ -1410,6 +1442,15 @@ void AliJetResponseMaker::DoJetLoop()
   jets2->ResetCurrentID();
   while ((jet2 = jets2->GetNextJet())) jet2->ResetMatching();
 
+  if (fFastMatching && fMatching == kGeometrical) {
+    DoGeometricalMatchingLoop(jets1, jets2);
+    return;
+  }
+  if (fFastMatching && fMatching == kMCLabel) {
+    DoMCLabelMatchingLoop(jets1, jets2);
+    return;
+  }
+
   jets1->ResetCurrentID();
   while ((jet1 = jets1->GetNextJet())) {
     jet1->ResetMatching();
@@ -1423,6 +1464,219 @@ void AliJetResponseMaker::DoJetLoop()
   } // jet1 loop
 }
 
+//________________________________________________________________________
+void AliJetResponseMaker::DoGeometricalMatchingLoop(AliJetContainer *jets1, AliJetContainer *jets2)
+{
+  // Geometrical matching with the jets2 sorted in an eta-phi grid with cells larger than the matching distance:
+  // each jet1 is compared only with the jets2 of the neighbouring cells, in the order of the full loop,
+  // so the pairs closer than the matching distance (the only ones that can be matched) come out the same.
+
+  AliEmcalJet* jet1 = 0;
+  AliEmcalJet* jet2 = 0;
+
+  std::vector<AliEmcalJet*> jetList2;
+  jets2->ResetCurrentID();
+  while ((jet2 = jets2->GetNextJet())) jetList2.push_back(jet2);
+  const Int_t nJets2 = jetList2.size();
+
+  const Double_t cellSize = TMath::Max(fMatchingPar1, fMatchingPar2) * 1.0001;
+  const Int_t nPhi = cellSize > 0 ? Int_t(TMath::TwoPi() / cellSize) : 0;
+
+  Double_t etaMin = 0;
+  Double_t etaMax = 0;
+  for (Int_t i = 0; i < nJets2; i++) {
+    if (i == 0 || jetList2[i]->Eta() < etaMin) etaMin = jetList2[i]->Eta();
+    if (i == 0 || jetList2[i]->Eta() > etaMax) etaMax = jetList2[i]->Eta();
+  }
+  const Int_t nEta = nPhi >= 3 ? Int_t((etaMax - etaMin) / cellSize) + 1 : 0;
+  const Double_t cellPhi = nPhi >= 3 ? TMath::TwoPi() / nPhi : 0;
+
+  // jets2 of each cell, in the order of the jet loop
+  std::vector<Int_t> cellFirst(nEta * nPhi + 1, 0);
+  std::vector<Int_t> cellJets(nJets2);
+  std::vector<Int_t> jetCell(nJets2, 0);
+  for (Int_t i = 0; i < nJets2 && nEta > 0; i++) {
+    Int_t iEta = TMath::Min(Int_t((jetList2[i]->Eta() - etaMin) / cellSize), nEta - 1);
+    Int_t iPhi = TMath::Min(Int_t(TVector2::Phi_0_2pi(jetList2[i]->Phi()) / cellPhi), nPhi - 1);
+    jetCell[i] = iEta * nPhi + iPhi;
+    cellFirst[jetCell[i] + 1]++;
+  }
+  for (Int_t c = 0; c < nEta * nPhi; c++) cellFirst[c + 1] += cellFirst[c];
+  std::vector<Int_t> cellFill(cellFirst.begin(), cellFirst.end());
+  for (Int_t i = 0; i < nJets2 && nEta > 0; i++) cellJets[cellFill[jetCell[i]]++] = i;
+
+  std::vector<Int_t> candidates;
+  candidates.reserve(nJets2);
+
+  jets1->ResetCurrentID();
+  while ((jet1 = jets1->GetNextJet())) {
+    jet1->ResetMatching();
+
+    if (jet1->MCPt() < fMinJetMCPt) continue;
+
+    if (nEta == 0) { // matching distance too large for the grid, compare with all jets2
+      for (Int_t i = 0; i < nJets2; i++) SetMatchingLevel(jet1, jetList2[i], kGeometrical);
+      continue;
+    }
+
+    Double_t etaPos = (jet1->Eta() - etaMin) / cellSize;
+    if (etaPos < -1 || etaPos >= nEta + 1) continue;
+    Int_t iEta = Int_t(TMath::Floor(etaPos));
+    Int_t iPhi = TMath::Min(Int_t(TVector2::Phi_0_2pi(jet1->Phi()) / cellPhi), nPhi - 1);
+
+    candidates.clear();
+    for (Int_t jEta = iEta - 1; jEta <= iEta + 1; jEta++) {
+      if (jEta < 0 || jEta >= nEta) continue;
+      for (Int_t dPhi = -1; dPhi <= 1; dPhi++) {
+        Int_t c = jEta * nPhi + (iPhi + dPhi + nPhi) % nPhi;
+        for (Int_t k = cellFirst[c]; k < cellFirst[c + 1]; k++) candidates.push_back(cellJets[k]);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (UInt_t k = 0; k < candidates.size(); k++) SetMatchingLevel(jet1, jetList2[candidates[k]], kGeometrical);
+  }
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::DoMCLabelMatchingLoop(AliJetContainer *jets1, AliJetContainer *jets2)
+{
+  // MC label matching with an index from the particles to the particle-level jets (jets2) containing them,
+  // built once per event: the pt shared by a detector-level jet with all the particle-level jets is collected
+  // in one pass over its constituents, instead of one pass over the constituents of both jets per jet pair.
+  // Same matching levels as GetMCLabelMatchingLevel, up to the summation order; the shared particle-level pt
+  // is the pt of the jet2 constituent itself.
+
+  AliEmcalJet* jet1 = 0;
+  AliEmcalJet* jet2 = 0;
+
+  AliParticleContainer *tracks1 = jets1->GetParticleContainer();
+  AliParticleContainer *tracks2 = jets2->GetParticleContainer();
+
+  std::vector<AliEmcalJet*> jetList2;
+  std::vector<LabelIndexEntry> index;
+  jets2->ResetCurrentID();
+  while ((jet2 = jets2->GetNextJet())) {
+    for (Int_t iTrack2 = 0; iTrack2 < jet2->GetNumberOfTracks(); iTrack2++) {
+      AliVParticle *part = jet2->Track(iTrack2);
+      LabelIndexEntry entry;
+      entry.fIndex = jet2->TrackAt(iTrack2);
+      entry.fJet = jetList2.size();
+      entry.fPt = part ? part->Pt() : 0;
+      index.push_back(entry);
+    }
+    jetList2.push_back(jet2);
+  }
+  std::stable_sort(index.begin(), index.end());
+
+  const Int_t nJets2 = jetList2.size();
+  std::vector<Double_t> shared1(nJets2);
+  std::vector<Double_t> shared2(nJets2);
+  std::vector<Int_t> found(index.size(), -1);
+  Int_t foundId = 0;
+
+  jets1->ResetCurrentID();
+  while ((jet1 = jets1->GetNextJet())) {
+    jet1->ResetMatching();
+
+    if (jet1->MCPt() < fMinJetMCPt) continue;
+
+    foundId++;
+    std::fill(shared1.begin(), shared1.end(), 0.);
+    std::fill(shared2.begin(), shared2.end(), 0.);
+
+    Double_t d1 = jet1->Pt();
+    Double_t totalPt1 = d1; // the total pt of the reconstructed jet will be cleaned from the background
+
+    for (Int_t iTrack = 0; iTrack < jet1->GetNumberOfTracks(); iTrack++) {
+      AliVParticle *track = jet1->Track(iTrack);
+      if (!track) {
+        AliWarning(Form("Could not find track %d!", iTrack));
+        continue;
+      }
+      Int_t MClabel = TMath::Abs(track->GetLabel());
+      MClabel -= fMCLabelShift;
+      if (MClabel == 0) { // this is not a MC particle; remove it completely
+        if (tracks1 && tracks1->GetArray()) {
+          totalPt1 -= track->Pt();
+          d1 -= track->Pt();
+        }
+        continue;
+      }
+      if (MClabel < 0) continue;
+      Int_t index2 = tracks2->GetIndexFromLabel(MClabel);
+      if (index2 < 0) continue;
+      AddSharedPt(index, found, foundId, index2, track->Pt(), 1., shared1, shared2);
+    }
+
+    for (Int_t iClus = 0; iClus < jet1->GetNumberOfClusters(); iClus++) {
+      AliVCluster *clus = jet1->Cluster(iClus);
+      if (!clus) {
+        AliWarning(Form("Could not find cluster %d!", iClus));
+        continue;
+      }
+      AliTLorentzVector part;
+      clus->GetMomentum(part, fVertex);
+
+      if (fUseCellsToMatch && fCaloCells) {
+        for (Int_t iCell = 0; iCell < clus->GetNCells(); iCell++) {
+          Int_t cellId = clus->GetCellAbsId(iCell);
+          Double_t cellFrac = clus->GetCellAmplitudeFraction(iCell);
+
+          Int_t MClabel = TMath::Abs(fCaloCells->GetCellMCLabel(cellId));
+          MClabel -= fMCLabelShift;
+          if (MClabel == 0) { // this is not a MC particle; remove it completely
+            totalPt1 -= part.Pt() * cellFrac;
+            d1 -= part.Pt() * cellFrac;
+            continue;
+          }
+          if (MClabel < 0) continue;
+          Int_t index2 = tracks2->GetIndexFromLabel(MClabel);
+          if (index2 < 0) continue;
+          AddSharedPt(index, found, foundId, index2, part.Pt() * cellFrac, cellFrac, shared1, shared2);
+        }
+      }
+      else {
+        Int_t MClabel = TMath::Abs(clus->GetLabel());
+        MClabel -= fMCLabelShift;
+        if (MClabel == 0) { // this is not a MC particle; remove it completely
+          totalPt1 -= part.Pt();
+          d1 -= part.Pt();
+          continue;
+        }
+        if (MClabel < 0) continue;
+        Int_t index2 = tracks2->GetIndexFromLabel(MClabel);
+        if (index2 < 0) continue;
+        AddSharedPt(index, found, foundId, index2, part.Pt(), 1., shared1, shared2);
+      }
+    }
+
+    for (Int_t i = 0; i < nJets2; i++) {
+      jet2 = jetList2[i];
+      Double_t e1 = d1 - shared1[i];
+      Double_t e2 = jet2->Pt() - shared2[i];
+
+      if (e1 < 0)
+        e1 = 0;
+
+      if (e2 < 0)
+        e2 = 0;
+
+      if (totalPt1 < 1)
+        e1 = -1;
+      else
+        e1 /= totalPt1;
+
+      if (jet2->Pt() < 1)
+        e2 = -1;
+      else
+        e2 /= jet2->Pt();
+
+      SetMatchingLevel(jet1, jet2, e1, e2);
+    }
+  }
+}
+
 //________________________________________________________________________
 void AliJetResponseMaker::GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const
 {
@@ -1867,6 +2121,14 @@ void AliJetResponseMaker::SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2,
     ;
   }
 
+  SetMatchingLevel(jet1, jet2, d1, d2);
+}
+
+//________________________________________________________________________
+void AliJetResponseMaker::SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t d1, Double_t d2)
+{
+  // Update the closest jets of jet1 and jet2 with their matching levels d1 and d2
+
   if (d1 >= 0) {
 
     if (d1 < jet1->ClosestJetDistance()) {
@@ -46,6 +46,7 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   void                        SetPtHardBin(Int_t b)                                           { fSelectPtHardBin   = b         ; }
   void                        SetUseCellsToMatch(Bool_t i)                                    { fUseCellsToMatch   = i         ; }
   void                        SetMinJetMCPt(Float_t pt)                                       { fMinJetMCPt        = pt        ; }
+  void                        SetFastMatching(Bool_t b=kTRUE)                                 { fFastMatching      = b         ; }
   void                        SetHistoType(Int_t b)                                           { fHistoType         = b         ; }
   void                        SetDeltaPtAxis(Int_t b)                                         { fDeltaPtAxis       = b         ; }
   void                        SetDeltaEtaDeltaPhiAxis(Int_t b)                                { fDeltaEtaDeltaPhiAxis= b       ; }
@@ -62,10 +63,13 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
  protected:
   void                        ExecOnce();
   void                        DoJetLoop();
+  void                        DoGeometricalMatchingLoop(AliJetContainer *jets1, AliJetContainer *jets2);
+  void                        DoMCLabelMatchingLoop(AliJetContainer *jets1, AliJetContainer *jets2);
   Bool_t                      FillHistograms();
   Bool_t                      Run();
   Bool_t                      DoJetMatching();
   void                        SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, MatchingType matching);
+  void                        SetMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t d1, Double_t d2);
   void                        GetGeometricalMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d) const;
   void                        GetMCLabelMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
   void                        GetSameCollectionsMatchingLevel(AliEmcalJet *jet1, AliEmcalJet *jet2, Double_t &d1, Double_t &d2) const;
@@ -80,6 +84,7 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   Double_t                    fMatchingPar2;                           // matching parameter for jet2-jet1 matching
   Bool_t                      fUseCellsToMatch;                        // use cells instead of clusters to match jets (slower but sometimes needed)
   Double_t                    fMinJetMCPt;                             // minimum jet MC pt
+  Bool_t                      fFastMatching;                           // geometrical matching on an eta-phi grid, MC label matching with a label index
   Int_t                       fHistoType;                              // histogram type (0=TH2, 1=THnSparse)
   Int_t                       fDeltaPtAxis;                            // add delta pt axis in THnSparse (default=0)
   Int_t                       fDeltaEtaDeltaPhiAxis;                   // add delta eta and delta phi axes in THnSparse (default=0)
@@ -172,6 +177,6 @@ class AliJetResponseMaker : public AliAnalysisTaskEmcalJet {
   AliJetResponseMaker(const AliJetResponseMaker&);            // not implemented
   AliJetResponseMaker &operator=(const AliJetResponseMaker&); // not implemented
 
-  ClassDef(AliJetResponseMaker, 29) // Jet response matrix producing task
+  ClassDef(AliJetResponseMaker, 30) // Jet response matrix producing task
 };
 #endif
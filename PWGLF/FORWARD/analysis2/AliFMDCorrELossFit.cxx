@@ -321,11 +321,29 @@ AliFMDCorrELossFit::ELossFit::Evaluate(Double_t x,
   return AliLandauGaus::Fn(x, fDelta, fXi, fSigma, fSigmaN, 
 			   TMath::Min(maxN, UShort_t(fN)), fA);
 }
+//____________________________________________________________________
+void
+AliFMDCorrELossFit::ELossFit::Evaluate(Int_t nx, const Double_t* x, 
+				       Double_t* f, UShort_t maxN) const
+{
+  // 
+  // Evaluate @f$ f_N(x;\Delta,\xi,\sigma')@f$ at nx points 
+  // 
+  // Parameters:
+  //    nx          Number of points 
+  //    x           Points to evaluate at 
+  //    f           On return, the function values 
+  //    maxN 	  @f$ \max{N}@f$    
+  //
+  AliLandauGaus::Fn(nx, x, f, fDelta, fXi, fSigma, fSigmaN, 
+		    TMath::Min(maxN, UShort_t(fN)), fA);
+}
 
 //____________________________________________________________________
 Double_t 
 AliFMDCorrELossFit::ELossFit::EvaluateWeighted(Double_t x, 
-					       UShort_t maxN) const
+					       UShort_t maxN,
+					       Bool_t   tabulated) const
 {									
   // 
   // Evaluate 
@@ -346,6 +364,7 @@ AliFMDCorrELossFit::ELossFit::EvaluateWeighted(Double_t x,
   // Parameters:
   //    x           Where to evaluate 
   //    maxN 	  @f$ \max{N}@f$      
+  //    tabulated   Interpolate in the table of the convolution
   // 
   // Return:
   //    @f$ f_W(x;\Delta,\xi,\sigma')@f$.  
@@ -356,7 +375,9 @@ AliFMDCorrELossFit::ELossFit::EvaluateWeighted(Double_t x,
   for (Int_t i = 1; i <= n; i++) {
     Double_t a = (i == 1 ? 1 : fA[i-1]);
     if (fA[i-1] < 0) break;
-    Double_t f = AliLandauGaus::Fi(x,fDelta,fXi,fSigma,fSigmaN,i);
+    Double_t f = (tabulated ? 
+		  AliLandauGaus::FiTable(x,fDelta,fXi,fSigma,fSigmaN,i) :
+		  AliLandauGaus::Fi(x,fDelta,fXi,fSigma,fSigmaN,i));
     num += i * a * f;
     den += a * f;
   }
@@ -268,6 +268,17 @@ public:
      */
     Double_t Evaluate(Double_t x, 
 		      UShort_t maxN=999) const;
+    /** 
+     * Evaluate @f$ f_N(x;\Delta,\xi,\sigma')@f$ (see above) at
+     * @f$ n_x@f$ points at once
+     *
+     * @param nx          Number of points 
+     * @param x           Array of @f$ n_x@f$ points 
+     * @param f           On return, @f$ f_N@f$ at the points 
+     * @param maxN 	  @f$ \max{N}@f$    
+     */
+    void Evaluate(Int_t nx, const Double_t* x, Double_t* f, 
+		  UShort_t maxN=999) const;
     /** 
      * Evaluate 
      * @f[ 
@@ -286,11 +297,14 @@ public:
      * 
      * @param x           Where to evaluate 
      * @param maxN 	  @f$ \max{N}@f$      
+     * @param tabulated   If true, interpolate in the table of the
+     *                    convolution (see AliLandauGaus::FTable)
      * 
      * @return @f$ f_W(x;\Delta,\xi,\sigma')@f$.  
      */
     Double_t EvaluateWeighted(Double_t x, 
-			      UShort_t maxN=9999) const;
+			      UShort_t maxN=9999,
+			      Bool_t   tabulated=false) const;
     /** 
      * Find the maximum weight to use.  The maximum weight is the
      * largest i for which 
@@ -39,6 +39,7 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fCorrections(0),
     fMaxParticles(5),
     fUsePoisson(false),
+    fUseELossTable(false),
     fUsePhiAcceptance(kPhiCorrectNch),
     fAccI(0),
     fAccO(0),
@@ -77,6 +78,7 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fCorrections(0),
     fMaxParticles(5),
     fUsePoisson(false),
+    fUseELossTable(false),
     fUsePhiAcceptance(kPhiCorrectNch),
     fAccI(0),
     fAccO(0),
@@ -146,6 +148,7 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fCorrections(o.fCorrections),
     fMaxParticles(o.fMaxParticles),
     fUsePoisson(o.fUsePoisson),
+    fUseELossTable(o.fUseELossTable),
     fUsePhiAcceptance(o.fUsePhiAcceptance),
     fAccI(o.fAccI),
     fAccO(o.fAccO),
@@ -211,6 +214,7 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fDebug              = o.fDebug;
   fMaxParticles       = o.fMaxParticles;
   fUsePoisson         = o.fUsePoisson;
+  fUseELossTable      = o.fUseELossTable;
   fUsePhiAcceptance   = o.fUsePhiAcceptance;
   fAccI               = o.fAccI;
   fAccO               = o.fAccO;
@@ -258,6 +262,7 @@ AliFMDDensityCalculator::SetupForData(const TAxis& axis)
   RingHistos* o = 0;
   while ((o = static_cast<RingHistos*>(next()))) {
     o->SetupForData(axis);
+    CacheStripLookup(o);
     // o->fMultCut = fCuts.GetFixedCut(o->fDet, o->fRing);
     // o->fPoisson.Init(o->fDet,o->fRing,fEtaLumping, fPhiLumping);
   }
@@ -343,6 +348,30 @@ AliFMDDensityCalculator::GetMultCut(UShort_t d, Char_t r, Double_t eta,
   // return fCuts.GetMultCut(d,r,eta,errors);
 }
 
+namespace {
+  Bool_t StripEtaPhi(Double_t xD, Double_t yD, Double_t zD,
+		     const TVector3& ip, Double_t& eta, Double_t& phi) 
+  {
+    // Same as AliForwardUtil::GetEtaPhi, but with cached strip position 
+    if (zD == AliForwardUtil::kInvalidValue) return false;
+    Double_t   iX      = ip.X(); if (iX > 100) iX = 0; // No X
+    Double_t   iY      = ip.Y(); if (iY > 100) iY = 0; // No Y
+    Double_t   dX      = xD-iX;
+    Double_t   dY      = yD-iY;
+    Double_t   dZ      = zD-ip.Z();
+    Double_t   r       = TMath::Sqrt(TMath::Power(dX,2)+
+				     TMath::Power(dY,2));
+    Double_t   theta   = TMath::ATan2(r, dZ);
+    Double_t   tant    = TMath::Tan(theta/2);
+    if (TMath::Abs(theta) < 1e-9) return false;
+    phi = TMath::ATan2(dY, dX);
+    eta = -TMath::Log(tant);
+    if (phi < 0)              phi += TMath::TwoPi();
+    if (phi > TMath::TwoPi()) phi -= TMath::TwoPi();
+    return true;
+  }
+}
+
 #ifndef NO_TIMING
 # define START_TIMER(T) if (fDoTiming) T.Start(true)
 # define GET_TIMER(T,V) if (fDoTiming) V = T.CpuTime()
@@ -430,6 +459,15 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
       // etaCache.Reset(AliESDFMD::kInvalidEta);
       // phiCache.Reset(AliESDFMD::kInvalidEta);
 
+      // --- Lookup tables set up in CacheStripLookup ----------------
+      const Double_t* stripX  = rh->fStripX.GetArray();
+      const Double_t* stripY  = rh->fStripY.GetArray();
+      const Double_t* stripZ  = rh->fStripZ.GetArray();
+      const Float_t*  accCorr = rh->fAccCorr.GetArray();
+      const Double_t* lowCut  = rh->fLowCut.GetArray();
+      const Int_t*    maxW    = rh->fMaxWeight.GetArray();
+      TAxis*          etaAxis = fLowCuts->GetXaxis();
+
       // --- Loop over sectors and strips ----------------------------
       for (UShort_t s=0; s<ns; s++) { 
 	for (UShort_t t=0; t<nt; t++) {
@@ -443,7 +481,9 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  if (fRecalculatePhi) {
 	    // Correct for (x,y) off set of the interaction point 
 	    // AliForwardUtil::GetEtaPhiFromStrip(r,t,eta,phi,ip.X(),ip.Y());
-	    if (!AliForwardUtil::GetEtaPhi(d,r,s,t,ip,eta,phi) ||
+	    // if (!AliForwardUtil::GetEtaPhi(d,r,s,t,ip,eta,phi) ||
+	    if (!StripEtaPhi(stripX[s*nt+t], stripY[s*nt+t], stripZ[s*nt+t],
+			     ip, eta, phi) ||
 		TMath::Abs(eta) < 1) {
 	      AliWarningF("FMD%d%c[%2d,%3d] (%f,%f,%f) eta=%f phi=%f (%f)",
 			  d, r, s, t, ip.X(), ip.Y(), ip.Z(), eta,
@@ -485,18 +525,30 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 
 	  // --- Apply phi corner correction to eloss ----------------
 	  if (fUsePhiAcceptance == kPhiCorrectELoss) 
-	    mult *= AcceptanceCorrection(r,t);
+	    mult *= accCorr[t]; // AcceptanceCorrection(r,t);
 
 	  // --- Get the low multiplicity cut ------------------------
 	  Double_t cut  = 1024;
-	  if (eta != AliESDFMD::kInvalidEta) cut = GetMultCut(d, r, eta,false);
+	  Int_t    iEta = 0;
+	  if (eta != AliESDFMD::kInvalidEta) {
+	    // cut = GetMultCut(d, r, eta,false);
+	    iEta = etaAxis->FindBin(eta);
+	    cut  = lowCut[iEta];
+	  }
 	  else AliWarningF("Eta for FMD%d%c[%02d,%03d] is invalid: %f", 
 			   d, r, s, t, eta);
 
 	  // --- Now caluculate Nch for this strip using fits --------
 	  START_TIMER(timer);
 	  Double_t n   = 0;
-	  if (cut > 0 && mult > cut) n = NParticles(mult,d,r,eta,lowFlux);
+	  if (cut > 0 && mult > cut) {
+	    // The fits are looked up at single precision eta 
+	    Int_t iFit = (Double_t(Float_t(eta)) == eta ? iEta : 
+			  etaAxis->FindBin(Float_t(eta)));
+	    AliFMDCorrELossFit::ELossFit* fit = 
+	      static_cast<AliFMDCorrELossFit::ELossFit*>(rh->fFits.UncheckedAt(iFit));
+	    n = NParticles(mult,d,r,eta,lowFlux,fit,maxW[iFit]);
+	  }
 	  rh->fELoss->Fill(mult);
 	  // rh->fEvsN->Fill(mult,n);
 	  // rh->fEtaVsN->Fill(eta, n);
@@ -507,7 +559,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  // Temporary stuff - remove Correction call 
 	  Double_t c = 1;
 	  if (fUsePhiAcceptance == kPhiCorrectNch) 
-	    c = AcceptanceCorrection(r,t);
+	    c = accCorr[t]; // AcceptanceCorrection(r,t);
 	  // Double_t c = Correction(d,r,t,eta,lowFlux);
 	  ADD_TIMER(timer,corrTime);
 	  fCorrections->Fill(c);
@@ -773,6 +825,66 @@ AliFMDDensityCalculator::CacheMaxWeights(const TAxis& axis)
   fCuts.FillHistogram(fLowCuts);
 }
 
+//_____________________________________________________________________
+void
+AliFMDDensityCalculator::CacheStripLookup(RingHistos* rh) const
+{
+  // 
+  // Fill the lookup tables of a ring.  The strip positions do not
+  // depend on the interaction point, and the acceptance corrections,
+  // cuts, fits, and maximum weights only depend on the eta bin, so
+  // these are set up once rather than for each strip in each event.
+  // 
+  DGUARD(fDebug, 2, "Cache strip lookup for FMD%d%c", rh->fDet, rh->fRing);
+  UShort_t d  = rh->fDet;
+  Char_t   r  = rh->fRing;
+  UShort_t ns = (r == 'I' || r == 'i' ?  20 :  40);
+  UShort_t nt = (r == 'I' || r == 'i' ? 512 : 256);
+
+  // --- Strip positions (see AliForwardUtil::GetXYZ) ----------------
+  rh->fStripX.Set(ns*nt);
+  rh->fStripY.Set(ns*nt);
+  rh->fStripZ.Set(ns*nt);
+  for (UShort_t s = 0; s < ns; s++) { 
+    Double_t phiD = AliForwardUtil::GetSectorPhi(d, r, s);
+    Double_t zD   = AliForwardUtil::GetSectorZ(d, r, s);
+    for (UShort_t t = 0; t < nt; t++) { 
+      Double_t rD = AliForwardUtil::GetStripR(r, t);
+      Int_t    k  = s*nt+t;
+      if (phiD == AliForwardUtil::kInvalidValue || 
+	  zD   == AliForwardUtil::kInvalidValue) {
+	rh->fStripX[k] = rh->fStripY[k] = AliForwardUtil::kInvalidValue;
+	rh->fStripZ[k] = AliForwardUtil::kInvalidValue;
+	continue;
+      }
+      rh->fStripX[k] = rD*TMath::Cos(phiD);
+      rh->fStripY[k] = rD*TMath::Sin(phiD);
+      rh->fStripZ[k] = zD;
+    }
+  }
+
+  // --- Acceptance corrections --------------------------------------
+  rh->fAccCorr.Set(nt);
+  TH1D* acc = (r == 'I' || r == 'i' ? fAccI : fAccO);
+  for (UShort_t t = 0; t < nt; t++) 
+    rh->fAccCorr[t] = (acc ? AcceptanceCorrection(r, t) : 1);
+
+  // --- Per eta bin, including under- and overflow ------------------
+  AliForwardCorrectionManager&  fcm  = AliForwardCorrectionManager::Instance();
+  const AliFMDCorrELossFit*     cor  = fcm.GetELossFit();
+  Int_t                         nEta = fLowCuts->GetXaxis()->GetNbins();
+  rh->fLowCut.Set(nEta+2);
+  rh->fMaxWeight.Set(nEta+2);
+  rh->fFits.Clear();
+  rh->fFits.Expand(nEta+2);
+  for (Int_t i = 0; i <= nEta+1; i++) { 
+    rh->fLowCut[i]    = GetMultCut(d, r, i, false);
+    rh->fMaxWeight[i] = (i >= 1 && i <= nEta ? GetMaxWeight(d, r, i-1) : -1);
+    rh->fFits.AddAt(cor && i >= 1 && i <= nEta ? cor->FindFit(d,r,i,-1) : 0, 
+		    i);
+  }
+}
+
 //_____________________________________________________________________
 Int_t
 AliFMDDensityCalculator::GetMaxWeight(UShort_t d, Char_t r, Int_t iEta) const
@@ -860,25 +972,44 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   //    The number of particles 
   //
   // if (mult <= GetMultCut()) return 0;
-  DGUARD(fDebug, 3, "Calculate Nch in FMD density calculator");
   if (lowFlux) return 1;
   
   AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
   AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
+  Int_t                         m   = (fit ? GetMaxWeight(d,r,eta) : -1);
+  return NParticles(mult, d, r, eta, lowFlux, fit, m);
+}
+
+//_____________________________________________________________________
+Float_t 
+AliFMDDensityCalculator::NParticles(Float_t  mult, 
+				    UShort_t d, 
+				    Char_t   r, 
+				    Float_t  eta,
+				    Bool_t   lowFlux,
+				    AliFMDCorrELossFit::ELossFit* fit,
+				    Int_t    m) const
+{
+  // 
+  // Get the number of particles corresponding to the signal mult,
+  // given the energy loss fit and maximum weight at eta 
+  // 
+  DGUARD(fDebug, 3, "Calculate Nch in FMD density calculator");
+  if (lowFlux) return 1;
+  
   if (!fit) { 
     AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
 		    d, r, eta, fMinQuality));
     return 0;
   }
   
-  Int_t    m   = GetMaxWeight(d,r,eta); // fit->FindMaxWeight();
   if (m < 1) { 
     AliWarning(Form("No good fits for FMD%d%c at eta=%f", d, r, eta));
     return 0;
   }
   
   UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
-  Double_t ret = fit->EvaluateWeighted(mult, n);
+  Double_t ret = fit->EvaluateWeighted(mult, n, fUseELossTable);
   
   if (fDebug > 10) {
     AliInfo(Form("FMD%d%c, eta=%7.4f, %8.5f -> %8.5f", d, r, eta, mult, ret));
@@ -1113,6 +1244,7 @@ AliFMDDensityCalculator::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxParticle",  fMaxParticles));
   d->Add(AliForwardUtil::MakeParameter("minQuality",   fMinQuality));
   d->Add(AliForwardUtil::MakeParameter("method",       fUsePoisson));
+  d->Add(AliForwardUtil::MakeParameter("elossTable",   fUseELossTable));
   d->Add(AliForwardUtil::MakeParameter("phiAcceptance",fUsePhiAcceptance));
   d->Add(AliForwardUtil::MakeParameter("etaLumping",   fEtaLumping));
   d->Add(AliForwardUtil::MakeParameter("phiLumping",   fPhiLumping));
@@ -1193,6 +1325,7 @@ AliFMDDensityCalculator::Print(Option_t* option) const
 
   PFV("Max(particles)",		fMaxParticles);
   PFB("Poisson method",		fUsePoisson);
+  PFB("Tabulated energy loss",	fUseELossTable);
   PFV("Eta lumping",		fEtaLumping);
   PFV("Phi lumping",		fPhiLumping);
   PFB("Recalculate phi",	fRecalculatePhi);
@@ -1265,7 +1398,14 @@ AliFMDDensityCalculator::RingHistos::RingHistos()
     fPhiBefore(0),
     fPhiAfter(0),
     fEtaBefore(0),
-    fEtaAfter(0)
+    fEtaAfter(0),
+    fStripX(),
+    fStripY(),
+    fStripZ(),
+    fAccCorr(),
+    fLowCut(),
+    fMaxWeight(),
+    fFits()
 {
   // 
   // Default CTOR
@@ -1298,7 +1438,14 @@ AliFMDDensityCalculator::RingHistos::RingHistos(UShort_t d, Char_t r)
     fPhiBefore(0),
     fPhiAfter(0),
     fEtaBefore(0),
-    fEtaAfter(0)
+    fEtaAfter(0),
+    fStripX(),
+    fStripY(),
+    fStripZ(),
+    fAccCorr(),
+    fLowCut(),
+    fMaxWeight(),
+    fFits()
 {
   // 
   // Constructor
@@ -1484,7 +1631,14 @@ AliFMDDensityCalculator::RingHistos::RingHistos(const RingHistos& o)
     fPhiBefore(o.fPhiBefore),
     fPhiAfter(o.fPhiAfter),
     fEtaBefore(o.fEtaBefore),
-    fEtaAfter(o.fEtaAfter)
+    fEtaAfter(o.fEtaAfter),
+    fStripX(o.fStripX),
+    fStripY(o.fStripY),
+    fStripZ(o.fStripZ),
+    fAccCorr(o.fAccCorr),
+    fLowCut(o.fLowCut),
+    fMaxWeight(o.fMaxWeight),
+    fFits(o.fFits)
 {
   // 
   // Copy constructor 
@@ -1549,6 +1703,13 @@ AliFMDDensityCalculator::RingHistos::operator=(const RingHistos& o)
   fPhiAfter            = static_cast<TH1D*>(o.fPhiAfter->Clone());
   fEtaBefore           = static_cast<TH1D*>(o.fEtaBefore->Clone());
   fEtaAfter            = static_cast<TH1D*>(o.fEtaAfter->Clone());
+  fStripX              = o.fStripX;
+  fStripY              = o.fStripY;
+  fStripZ              = o.fStripZ;
+  fAccCorr             = o.fAccCorr;
+  fLowCut              = o.fLowCut;
+  fMaxWeight           = o.fMaxWeight;
+  fFits                = o.fFits;
   return *this;
 }
 //____________________________________________________________________
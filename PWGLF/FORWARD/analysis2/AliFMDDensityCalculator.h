@@ -16,15 +16,18 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayF.h>
+#include <TArrayD.h>
+#include <TObjArray.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
+#include "AliFMDCorrELossFit.h"
 #include "AliPoissonCalculator.h"
 class AliESDFMD;
 class TH2D;
 class TH1D;
 class TProfile;
-class AliFMDCorrELossFit;
 
 /** 
  * This class calculates the inclusive charged particle density
@@ -156,6 +159,16 @@ public:
    * number of particles that has hit within a region.
    */
   void SetUsePoisson(Bool_t u) { fUsePoisson = u; }
+  /** 
+   * Whether to evaluate the energy loss response in the weighted
+   * particle number from the table of the Landau-Gauss convolution
+   * (see AliLandauGaus::FTable) rather than by direct numerical
+   * convolution.  The table is much faster to evaluate, but differs
+   * from the direct evaluation at the @f$10^{-4}@f$ level.
+   * 
+   * @param use Whether to use the table 
+   */
+  void SetUseELossTable(Bool_t use) { fUseELossTable = use; }
   /** 
    * In case of a displaced vertices recalculate eta and angle correction
    * 
@@ -336,6 +349,27 @@ protected:
 			     Char_t   r, 
 			     Float_t  eta, 
 			     Bool_t   lowFlux) const;
+  /** 
+   * Get the number of particles corresponding to the signal mult
+   * from an already found energy loss fit and maximum weight
+   * 
+   * @param mult     Signal
+   * @param d        Detector
+   * @param r        Ring 
+   * @param eta      Pseudo-rapidity 
+   * @param lowFlux  Low-flux flag 
+   * @param fit      Energy loss fit at @a eta (or null)
+   * @param m        Maximum weight at @a eta 
+   * 
+   * @return The number of particles 
+   */
+  Float_t NParticles(Float_t  mult, 
+		     UShort_t d, 
+		     Char_t   r, 
+		     Float_t  eta, 
+		     Bool_t   lowFlux,
+		     AliFMDCorrELossFit::ELossFit* fit,
+		     Int_t    m) const;
   /** 
    * Get the inverse correction factor.  This consist of
    * 
@@ -465,6 +499,13 @@ protected:
     TH1D*     fPhiAfter;       // Phi after re-calc
     TH1D*     fEtaBefore;      // Phi before re-calce 
     TH1D*     fEtaAfter;       // Phi after re-calc
+    TArrayD   fStripX;         // X of strips (index sector*nStrips+strip)
+    TArrayD   fStripY;         // Y of strips (index sector*nStrips+strip)
+    TArrayD   fStripZ;         // Z of strips (index sector*nStrips+strip)
+    TArrayF   fAccCorr;        // Acceptance correction per strip 
+    TArrayD   fLowCut;         // Multiplicity cut per eta bin (0 to N+1)
+    TArrayI   fMaxWeight;      // Maximum weight per eta bin (0 to N+1)
+    TObjArray fFits;           // Energy loss fits per eta bin (not owned)
     // ClassDef(RingHistos,10);
   };
   /** 
@@ -476,12 +517,23 @@ protected:
    * @return Ring histogram container 
    */
   RingHistos* GetRingHistos(UShort_t d, Char_t r) const;
+  /** 
+   * Fill the per-strip and per-@f$\eta@f$ bin lookup tables of a
+   * ring (strip positions, acceptance corrections, multiplicity cuts,
+   * energy loss fits and maximum weights), so that these need not be
+   * found for each strip in each event.  Must be called after
+   * CacheMaxWeights.
+   * 
+   * @param rh Ring histograms to fill the tables of 
+   */
+  void CacheStripLookup(RingHistos* rh) const;
   TList    fRingHistos;    //  List of histogram containers
   TH1D*    fSumOfWeights;  //  Histogram
   TH1D*    fWeightedSum;   //  Histogram
   TH1D*    fCorrections;   //  Histogram
   UShort_t fMaxParticles;  //  Maximum particle weight to use 
   Bool_t   fUsePoisson;    //  If true, then use poisson statistics 
+  Bool_t   fUseELossTable; //  If true, use tabulated Landau-Gauss
   UShort_t fUsePhiAcceptance; // Whether to correct for corners 
   TH1D*    fAccI;          //  Acceptance correction for inner rings
   TH1D*    fAccO;          //  Acceptance correction for outer rings
@@ -505,7 +557,7 @@ protected:
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
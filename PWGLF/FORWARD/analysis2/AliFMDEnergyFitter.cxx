@@ -16,6 +16,7 @@
 #include <TFitResult.h>
 #include <THStack.h>
 #include <TROOT.h>
+#include <TArrayD.h>
 #include <iostream>
 #include <iomanip>
 
@@ -1450,8 +1451,22 @@ AliFMDEnergyFitter::RingHistos::CalculateResiduals(EResidualMethod mode,
   resi->GetListOfFunctions()->Clear();
   resi->SetUniqueID(mode);
 
-    // Reset histogram
+  // Evaluate the fit at all bins with content at once 
   Int_t nX = resi->GetNbinsX();
+  TArrayD xs(nX);
+  TArrayD fs(nX);
+  Int_t   nF = 0;
+  for (Int_t i  = 1; i <= nX; i++) { 
+    Double_t x  = dist->GetBinCenter(i);
+    if (x < lowCut)  continue;
+    if (x > highCut) break;
+    if (dist->GetBinContent(i) > 0 && dist->GetBinError(i) > 0) 
+      xs[nF++] = x;
+  }
+  fit->Evaluate(nF, xs.GetArray(), fs.GetArray());
+
+    // Reset histogram
+  Int_t iF = 0;
   for (Int_t i  = 1; i <= nX; i++) { 
     Double_t x  = dist->GetBinCenter(i);
     if (x < lowCut)  continue;
@@ -1462,7 +1477,7 @@ AliFMDEnergyFitter::RingHistos::CalculateResiduals(EResidualMethod mode,
     Double_t r  = 0;
     Double_t er = 0;
     if (h > 0 && e > 0) { 
-      Double_t f = fit->GetC() * fit->Evaluate(x);
+      Double_t f = fit->GetC() * fs[iF++];
       if (f > 0) { 
 	r  = h-f;
 	switch (mode) { 
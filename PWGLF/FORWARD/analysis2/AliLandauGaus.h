@@ -13,6 +13,7 @@
 #include <TObject.h>
 #include <TF1.h>
 #include <TMath.h>
+#include <vector>
 
 /** 
  * This class contains static member functions to calculate the energy
@@ -326,6 +327,122 @@ public:
   static Double_t SigmaShift(Int_t i, Double_t xi, Double_t sigma);
   /* @} */
 
+  //__________________________________________________________________
+  /** 
+   * @{ 
+   * @name Batch and tabulated evaluation 
+   */
+  //------------------------------------------------------------------
+  /** 
+   * The Gaussian weights @f$ \exp(-t_j^2/2)@f$ of the sample points
+   * @f$ x'_j = x \mp t_j\sigma'@f$ used in F.  These depend only on
+   * NSigma() and NSteps(), so they are calculated once.
+   * 
+   * @return Array of NSteps()/2+1 weights 
+   */
+  static const Double_t* GausWeights();
+  //------------------------------------------------------------------
+  /** 
+   * Evaluate @f$ f_i@f$ (see Fi) at @f$ n_x@f$ points.  The
+   * parameters of the @f$ i@f$ particle response are calculated once
+   * for all points.
+   * 
+   * @param nx       Number of points 
+   * @param x        Array of @f$ n_x@f$ points 
+   * @param f        On return, @f$ f_i@f$ at the points 
+   * @param delta    @f$ \Delta@f$ 
+   * @param xi       @f$ \xi@f$ 
+   * @param sigma    @f$ \sigma@f$ 
+   * @param sigma_n  @f$ \sigma_n@f$
+   * @param i        @f$ i @f$
+   */
+  static void Fi(Int_t nx, const Double_t* x, Double_t* f, 
+		 Double_t delta, Double_t xi, 
+		 Double_t sigma, Double_t sigma_n, Int_t i);
+  //------------------------------------------------------------------
+  /** 
+   * Evaluate @f$ f_N@f$ (see Fn) at @f$ n_x@f$ points.  The terms
+   * are accumulated one @f$ i@f$ at a time, so that the parameters
+   * of each term are calculated once for all points.
+   * 
+   * @param nx       Number of points 
+   * @param x        Array of @f$ n_x@f$ points 
+   * @param f        On return, @f$ f_N@f$ at the points 
+   * @param delta    @f$ \Delta_1@f$ 
+   * @param xi       @f$ \xi_1@f$
+   * @param sigma    @f$ \sigma_1@f$ 
+   * @param sigma_n  @f$ \sigma_n@f$ 
+   * @param n        @f$ N@f$ 
+   * @param a        Array of size @f$ N-1@f$ of the weights @f$ a_i@f$ for 
+   *                 @f$ i > 1@f$ 
+   */
+  static void Fn(Int_t nx, const Double_t* x, Double_t* f, 
+		 Double_t delta, Double_t xi, 
+		 Double_t sigma, Double_t sigma_n, Int_t n, 
+		 const Double_t* a);
+  //------------------------------------------------------------------
+  /** 
+   * Table of the convolution in reduced variables 
+   *
+   * @f[ 
+   *   g(u;s) = \xi f(\Delta_p+u\xi;\Delta_p,\xi,\sigma') 
+   *          = f(u;0,1,s)\quad s = \sigma'/\xi
+   * @f] 
+   *
+   * on a regular grid in @f$ u@f$ and @f$\log s@f$. 
+   */
+  struct Table 
+  {
+    Double_t fUMin;         // Least u 
+    Double_t fUStep;        // Step in u
+    Int_t    fNU;           // Number of u points 
+    Double_t fLogSMin;      // Least log(s)
+    Double_t fLogSStep;     // Step in log(s)
+    Int_t    fNS;           // Number of s points 
+    std::vector<Double_t> fG; // g(u;s) at fG[is*fNU+iu] 
+  };
+  /** 
+   * Get the table of the reduced convolution.  It is filled on the
+   * first call (which takes a fraction of a second).
+   * 
+   * @return Reference to the table 
+   */
+  static const Table& GetTable();
+  //------------------------------------------------------------------
+  /** 
+   * Evaluate @f$ f(x;\Delta_p,\xi,\sigma')@f$ (see F) by bi-cubic
+   * interpolation in the table of the reduced convolution (see
+   * GetTable).  Outside the table, F is evaluated directly.  The
+   * relative precision is of the order of @f$ 10^{-4}@f$.
+   * 
+   * @param x         where to evaluate @f$ f@f$
+   * @param delta     @f$ \Delta_p@f$ 
+   * @param xi        @f$ \xi@f$ 
+   * @param sigma     @f$ \sigma@f$ 
+   * @param sigma_n   @f$ \sigma_n@f$ 
+   * 
+   * @return @f$ f@f$ evaluated at @f$ x@f$.  
+   */
+  static Double_t FTable(Double_t x, Double_t delta, Double_t xi, 
+			 Double_t sigma, Double_t sigma_n);
+  //------------------------------------------------------------------
+  /** 
+   * Evaluate @f$ f_i@f$ (see Fi) using the table of the reduced
+   * convolution (see FTable).
+   * 
+   * @param x        Where to evaluate 
+   * @param delta    @f$ \Delta@f$ 
+   * @param xi       @f$ \xi@f$ 
+   * @param sigma    @f$ \sigma@f$ 
+   * @param sigma_n  @f$ \sigma_n@f$
+   * @param i        @f$ i @f$
+   * 
+   * @return @f$ f_i @f$ evaluated
+   */  
+  static Double_t FiTable(Double_t x, Double_t delta, Double_t xi, 
+			  Double_t sigma, Double_t sigma_n, Int_t i);
+  /* @} */
+
   
   //__________________________________________________________________
   /** 
@@ -539,11 +656,12 @@ AliLandauGaus::F(Double_t x, Double_t delta, Double_t xi,
   const Double_t step   = (xhigh - xlow) / nSteps;
   Double_t       sum    = 0;
   
+  const Double_t* w     = GausWeights();
+  
   for (Int_t i = 0; i <= nSteps/2; i++) { 
     const Double_t x1 = xlow  + (i - .5) * step;
     const Double_t x2 = xhigh - (i - .5) * step;
-    sum += Fl(x1, deltaP, xi) * TMath::Gaus(x, x1, sigma1);
-    sum += Fl(x2, deltaP, xi) * TMath::Gaus(x, x2, sigma1);
+    sum += (Fl(x1, deltaP, xi) + Fl(x2, deltaP, xi)) * w[i];
   }
   return step * sum * InvSq2Pi() / sigma1;
 }
@@ -574,6 +692,135 @@ AliLandauGaus::Fn(Double_t x, Double_t delta, Double_t xi,
     result += a[i-2] * Fi(x,delta,xi,sigma,sigmaN,i);
   return result;
 }
+//____________________________________________________________________
+inline const Double_t*
+AliLandauGaus::GausWeights()
+{
+  static std::vector<Double_t> w;
+  if (!w.empty()) return &(w[0]);
+
+  const Int_t    nSteps = NSteps();
+  const Double_t nSigma = NSigma();
+  w.resize(nSteps/2+1);
+  for (Int_t i = 0; i <= nSteps/2; i++) { 
+    // Distance of x from x1=xlow+(i-.5)*step (and of x2 from x) in
+    // units of sigma'
+    const Double_t t = nSigma * (1 - (2 * i - 1.) / nSteps);
+    w[i] = TMath::Exp(-.5 * t * t);
+  }
+  return &(w[0]);
+}
+//____________________________________________________________________
+inline void
+AliLandauGaus::Fi(Int_t nx, const Double_t* x, Double_t* f, 
+		  Double_t delta, Double_t xi, 
+		  Double_t sigma, Double_t sigmaN, Int_t i)
+{
+  Double_t deltaI = delta;
+  Double_t xiI    = xi;
+  Double_t sigmaI = sigma;
+  IPars(i, deltaI, xiI, sigmaI);
+  if (sigmaI < 1e-10) {
+    // Fall back to landau 
+    for (Int_t j = 0; j < nx; j++) f[j] = Fl(x[j], deltaI, xiI);
+    return;
+  }
+  for (Int_t j = 0; j < nx; j++) f[j] = F(x[j], deltaI, xiI, sigmaI, sigmaN);
+}
+//____________________________________________________________________
+inline void
+AliLandauGaus::Fn(Int_t nx, const Double_t* x, Double_t* f, 
+		  Double_t delta, Double_t xi, 
+		  Double_t sigma, Double_t sigmaN, Int_t n, 
+		  const Double_t* a)
+{
+  Fi(nx, x, f, delta, xi, sigma, sigmaN, 1);
+  if (n < 2 || nx <= 0) return;
+
+  std::vector<Double_t> fi(nx);
+  for (Int_t i = 2; i <= n; i++) { 
+    Fi(nx, x, &(fi[0]), delta, xi, sigma, sigmaN, i);
+    for (Int_t j = 0; j < nx; j++) f[j] += a[i-2] * fi[j];
+  }
+}
+//____________________________________________________________________
+inline const AliLandauGaus::Table&
+AliLandauGaus::GetTable()
+{
+  static Table t;
+  if (!t.fG.empty()) return t;
+
+  // The range in u covers the peak and the tail up to where the
+  // Landau has dropped to ~1e-5 of its maximum.  The range in s
+  // covers what is seen for 1 to ~20 particles in the FMD. 
+  t.fUMin     = -6;
+  t.fUStep    = 0.1;
+  t.fNU       = 2001;
+  t.fLogSMin  = TMath::Log(0.02);
+  t.fNS       = 100;
+  t.fLogSStep = (TMath::Log(20.) - t.fLogSMin) / (t.fNS - 1);
+  t.fG.resize(t.fNU * t.fNS);
+  for (Int_t is = 0; is < t.fNS; is++) { 
+    const Double_t s = TMath::Exp(t.fLogSMin + is * t.fLogSStep);
+    for (Int_t iu = 0; iu < t.fNU; iu++) 
+      t.fG[is * t.fNU + iu] = F(t.fUMin + iu * t.fUStep, 0, 1, s, 0);
+  }
+  return t;
+}
+//____________________________________________________________________
+inline Double_t 
+AliLandauGaus::FTable(Double_t x, Double_t delta, Double_t xi,
+		      Double_t sigma, Double_t sigmaN)
+{
+  if (xi <= 0) return 0;
+
+  const Double_t sigma1 = (sigmaN == 0 ? sigma : 
+			   TMath::Sqrt(sigmaN*sigmaN + sigma*sigma));
+  if (sigma1 <= 0) return F(x, delta, xi, sigma, sigmaN);
+
+  const Table&   t  = GetTable();
+  const Double_t pu = ((x - delta) / xi - t.fUMin) / t.fUStep;
+  const Double_t ps = (TMath::Log(sigma1 / xi) - t.fLogSMin) / t.fLogSStep;
+  // Need one point below and two above the cell for cubic interpolation
+  if (!(pu >= 1 && pu < t.fNU - 2 && ps >= 1 && ps < t.fNS - 2)) 
+    return F(x, delta, xi, sigma, sigmaN);
+
+  const Int_t    iu = Int_t(pu);
+  const Int_t    is = Int_t(ps);
+  Double_t       wu[4], ws[4];
+  Double_t       p  = pu - iu;
+  wu[0] = -p * (p - 1) * (p - 2) / 6;
+  wu[1] = (p + 1) * (p - 1) * (p - 2) / 2;
+  wu[2] = -(p + 1) * p * (p - 2) / 2;
+  wu[3] = (p + 1) * p * (p - 1) / 6;
+  p     = ps - is;
+  ws[0] = -p * (p - 1) * (p - 2) / 6;
+  ws[1] = (p + 1) * (p - 1) * (p - 2) / 2;
+  ws[2] = -(p + 1) * p * (p - 2) / 2;
+  ws[3] = (p + 1) * p * (p - 1) / 6;
+
+  Double_t       sum = 0;
+  for (Int_t k = 0; k < 4; k++) { 
+    const Double_t* g = &(t.fG[(is - 1 + k) * t.fNU + iu - 1]);
+    sum += ws[k] * (wu[0]*g[0] + wu[1]*g[1] + wu[2]*g[2] + wu[3]*g[3]);
+  }
+  return sum / xi;
+}
+//____________________________________________________________________
+inline Double_t 
+AliLandauGaus::FiTable(Double_t x, Double_t delta, Double_t xi, 
+		       Double_t sigma, Double_t sigmaN, Int_t i)
+{
+  Double_t deltaI = delta;
+  Double_t xiI    = xi;
+  Double_t sigmaI = sigma;
+  IPars(i, deltaI, xiI, sigmaI);
+  if (sigmaI < 1e-10) 
+    // Fall back to landau 
+    return Fl(x, deltaI, xiI);
+  
+  return FTable(x, deltaI, xiI, sigmaI, sigmaN);
+}
 
 //____________________________________________________________________
 inline Double_t 
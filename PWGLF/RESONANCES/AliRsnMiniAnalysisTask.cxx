@@ -14,6 +14,8 @@
 //
 
 #include <Riostream.h>
+#include <algorithm>
+#include <vector>
 
 #include <TH1.h>
 #include <TList.h>
@@ -90,6 +92,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fMiniEvent(0x0),
    fBigOutput(kFALSE),
    fMixPrintRefresh(-1),
+   fMixCacheSize(-1),
    fMaxNDaughters(-1),
    fCheckP(kFALSE),
    fCheckFeedDown(kFALSE),   
@@ -145,6 +148,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC) :
    fMiniEvent(0x0),
    fBigOutput(kFALSE),
    fMixPrintRefresh(-1),
+   fMixCacheSize(-1),
    fMaxNDaughters(-1),
    fCheckP(kFALSE),
    fCheckFeedDown(kFALSE),   
@@ -205,6 +209,7 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fMiniEvent(0x0),
    fBigOutput(copy.fBigOutput),
    fMixPrintRefresh(copy.fMixPrintRefresh),
+   fMixCacheSize(copy.fMixCacheSize),
    fMaxNDaughters(copy.fMaxNDaughters),
    fCheckP(copy.fCheckP),
    fCheckFeedDown(copy.fCheckFeedDown),   
@@ -267,6 +272,7 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fESDtrackCuts = copy.fESDtrackCuts;
    fBigOutput = copy.fBigOutput;
    fMixPrintRefresh = copy.fMixPrintRefresh;
+   fMixCacheSize = copy.fMixCacheSize;
    fMaxNDaughters = copy.fMaxNDaughters;
    fCheckP = copy.fCheckP;
    fCheckFeedDown = copy.fCheckFeedDown;
@@ -480,7 +486,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // prepare variables
    Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
    Int_t idef, nDefs   = fHistograms.GetEntries();
-   Int_t imix, iloop, ifill;
+   Int_t imix, ifill;
    AliRsnMiniOutput *def = 0x0;
    AliRsnMiniOutput::EComputation compType;
 
@@ -491,6 +497,9 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       else printNum = 0;
    }
 
+   // compact table of the mixing keys, filled while reading the buffer for the single-event part
+   std::vector<Float_t> mixVz(nEvents), mixMult(nEvents), mixAngle(nEvents);
+
    // loop on events, and for each one fill all outputs
    // using the appropriate procedure depending on its type
    // only mother-related histograms are filled in UserExec,
@@ -499,6 +508,9 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    for (ievt = 0; ievt < nEvents; ievt++) {
       // get next entry
       fEvBuffer->GetEntry(ievt);
+      mixVz[ievt]    = fMiniEvent->Vz();
+      mixMult[ievt]  = fMiniEvent->Mult();
+      mixAngle[ievt] = fMiniEvent->Angle();
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] Std.Event %d/%d",GetName(), ievt,nEvents));
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
@@ -548,82 +560,165 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       return;
    }
 
-   // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
+   // build the mixing index: the events are grouped in cells of the (vz, mult, angle) keys
+   // and each cell keeps the ordered list of its entries; the partners of an event can only
+   // be in its own cell (binned mixing) or in the neighbouring ones (continuous mixing)
+   typedef std::pair<Int_t, std::pair<Int_t, Int_t> > MixCell_t;
+   std::map<MixCell_t, Int_t> cellIndex;
+   std::map<MixCell_t, Int_t>::iterator cellIt;
+   std::vector< std::vector<Int_t> > cellEntries;
+   std::vector<Int_t> evCell(nEvents);
+   Int_t cell[3], icell, ncells, ineigh, nneigh;
    for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
+      GetMixCell(mixVz[ievt], mixMult[ievt], mixAngle[ievt], cell);
+      MixCell_t key(cell[0], std::make_pair(cell[1], cell[2]));
+      cellIt = cellIndex.find(key);
+      if (cellIt == cellIndex.end()) {
+         cellIt = cellIndex.insert(std::make_pair(key, (Int_t)cellEntries.size())).first;
+         cellEntries.push_back(std::vector<Int_t>());
+      }
+      evCell[ievt] = cellIt->second;
+      cellEntries[cellIt->second].push_back(ievt);
+   }
+   ncells = (Int_t)cellEntries.size();
+   std::vector< std::vector<Int_t> > cellNeighbours(ncells);
+   for (cellIt = cellIndex.begin(); cellIt != cellIndex.end(); ++cellIt) {
+      icell = cellIt->second;
+      if (!fContinuousMix) {
+         cellNeighbours[icell].push_back(icell);
+         continue;
+      }
+      for (Int_t i0 = -1; i0 <= 1; i0++) for (Int_t i1 = -1; i1 <= 1; i1++) for (Int_t i2 = -1; i2 <= 1; i2++) {
+         MixCell_t key(cellIt->first.first + i0, std::make_pair(cellIt->first.second.first + i1, cellIt->first.second.second + i2));
+         std::map<MixCell_t, Int_t>::iterator neighIt = cellIndex.find(key);
+         if (neighIt != cellIndex.end()) cellNeighbours[icell].push_back(neighIt->second);
+      }
+   }
+   // events which have already enough matches cannot be taken as partners anymore:
+   // they are skipped in the cell lists through a 'next available entry' link
+   std::vector< std::vector<Int_t> > cellNext(ncells);
+   for (icell = 0; icell < ncells; icell++) {
+      cellNext[icell].resize(cellEntries[icell].size() + 1);
+      for (Int_t i = 0; i <= (Int_t)cellEntries[icell].size(); i++) cellNext[icell][i] = i;
    }
+   std::vector<Int_t> evPos(nEvents);
+   for (icell = 0; icell < ncells; icell++)
+      for (Int_t i = 0; i < (Int_t)cellEntries[icell].size(); i++) evPos[cellEntries[icell][i]] = i;
 
+   // initialize mixing counter
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector< std::vector<Int_t> > matched(nEvents);
 
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
    // search for good matchings
+   // the candidates are visited in the same order as a scan of the whole buffer
+   // starting from the event following the main one (ievt+1, ..., nEvents-1, 0, ..., ievt-1)
+   // which is obtained merging the lists of the neighbouring cells
+   std::vector<Int_t> scanStart, scanPos;
+   std::vector<Bool_t> scanWrapped;
+   Int_t ibest, dist, bestDist;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
+      const std::vector<Int_t> &neigh = cellNeighbours[evCell[ievt]];
+      nneigh = (Int_t)neigh.size();
+      scanStart.resize(nneigh);
+      scanPos.resize(nneigh);
+      scanWrapped.resize(nneigh);
+      for (ineigh = 0; ineigh < nneigh; ineigh++) {
+         const std::vector<Int_t> &entries = cellEntries[neigh[ineigh]];
+         scanStart[ineigh] = (Int_t)(std::upper_bound(entries.begin(), entries.end(), ievt) - entries.begin());
+         scanPos[ineigh] = NextMixEntry(cellNext[neigh[ineigh]], scanStart[ineigh]);
+         scanWrapped[ineigh] = kFALSE;
+      }
+      while (1) {
+         // next candidate among all the neighbouring cells
+         ibest = -1;
+         bestDist = nEvents;
+         for (ineigh = 0; ineigh < nneigh; ineigh++) {
+            if (scanPos[ineigh] < 0) continue;
+            const std::vector<Int_t> &entries = cellEntries[neigh[ineigh]];
+            if (!scanWrapped[ineigh] && scanPos[ineigh] >= (Int_t)entries.size()) {
+               scanWrapped[ineigh] = kTRUE;
+               scanPos[ineigh] = NextMixEntry(cellNext[neigh[ineigh]], 0);
+            }
+            if (scanWrapped[ineigh] && scanPos[ineigh] >= scanStart[ineigh]) {
+               scanPos[ineigh] = -1;
+               continue;
+            }
+            dist = entries[scanPos[ineigh]] - ievt;
+            if (dist < 0) dist += nEvents;
+            if (dist < bestDist) {
+               bestDist = dist;
+               ibest = ineigh;
+            }
+         }
+         if (ibest < 0) break;
+         imix = cellEntries[neigh[ibest]][scanPos[ibest]];
+         scanPos[ibest] = NextMixEntry(cellNext[neigh[ibest]], scanPos[ibest] + 1);
          if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
          // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
+         if (!EventsMatch(mixVz[ievt], mixMult[ievt], mixAngle[ievt], mixVz[imix], mixMult[imix], mixAngle[imix])) continue;
          // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
+         if (std::find(matched[imix].begin(), matched[imix].end(), ievt) != matched[imix].end()) continue;
          // check that the found good events has not enough matches already
          if (nmatched[imix] >= fNMix) continue;
          // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
+         matched[ievt].push_back(imix);
          nmatched[ievt]++;
          nmatched[imix]++;
+         if (nmatched[imix] >= fNMix) cellNext[evCell[imix]][evPos[imix]] = evPos[imix] + 1;
          if (nmatched[ievt] >= fNMix) break;
       }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
+      if (nmatched[ievt] >= fNMix) cellNext[evCell[ievt]][evPos[ievt]] = evPos[ievt] + 1;
+      AliDebugClass(1, Form("Matches for event %5d = %d (missing are declared above)", ievt, nmatched[ievt]));
    }
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      if (printNum&&(ievt%printNum==0)) {
-         AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
-         timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
-      }
-      ifill = 0;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
-         fEvBuffer->GetEntry(imix);
-         for (idef = 0; idef < nDefs; idef++) {
-            def = (AliRsnMiniOutput *)fHistograms[idef];
-            if (!def) continue;
-            if (!def->IsTrackPairMix()) continue;
-            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
-            if (!def->IsSymmetric()) {
-               AliDebugClass(2, "Reflecting non symmetric pair");
-               ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE);
+   // the events are visited cell by cell, so that consecutive events share most of
+   // their partners, which are then taken from a small cache of mini-events
+   Int_t cacheSize = (fMixCacheSize < 0) ? 4 * fNMix : fMixCacheSize;
+   std::map<Int_t, AliRsnMiniEvent *> cache;
+   std::deque<Int_t> cacheOrder;
+   AliRsnMiniEvent *evMain = 0x0, *evMix = 0x0;
+   Int_t iproc = 0;
+   for (icell = 0; icell < ncells; icell++) {
+      for (Int_t i = 0; i < (Int_t)cellEntries[icell].size(); i++, iproc++) {
+         ievt = cellEntries[icell][i];
+         if (printNum&&(iproc%printNum==0)) {
+            AliInfo(Form("[%s] EventMixing %d/%d",GetName(),iproc,nEvents));
+            timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
+         }
+         if (matched[ievt].empty()) continue;
+         ifill = 0;
+         evMain = GetBufferedEvent(ievt, -1, cacheSize, cache, cacheOrder);
+         for (Int_t j = 0; j < (Int_t)matched[ievt].size(); j++) {
+            imix = matched[ievt][j];
+            evMix = GetBufferedEvent(imix, ievt, cacheSize, cache, cacheOrder);
+            for (idef = 0; idef < nDefs; idef++) {
+               def = (AliRsnMiniOutput *)fHistograms[idef];
+               if (!def) continue;
+               if (!def->IsTrackPairMix()) continue;
+               ifill += def->FillPair(evMain, evMix, &fValues, kTRUE);
+               if (!def->IsSymmetric()) {
+                  AliDebugClass(2, "Reflecting non symmetric pair");
+                  ifill += def->FillPair(evMix, evMain, &fValues, kFALSE);
+               }
             }
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
+   for (std::map<Int_t, AliRsnMiniEvent *>::iterator it = cache.begin(); it != cache.end(); ++it) delete it->second;
+   cache.clear();
 
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
@@ -1418,33 +1513,34 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
 //
 
    if (!event1 || !event2) return kFALSE;
+   return EventsMatch(event1->Vz(), event1->Mult(), event1->Angle(), event2->Vz(), event2->Mult(), event2->Angle());
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniAnalysisTask::EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const
+{
+//
+// Same as above, from the mixing keys of the two events
+//
+
    Int_t ivz1, ivz2, imult1, imult2, iangle1, iangle2;
    Double_t dv, dm, da;
 
    if (fContinuousMix) {
-      dv = TMath::Abs(event1->Vz()    - event2->Vz()   );
-      dm = TMath::Abs(event1->Mult()  - event2->Mult() );
-      da = TMath::Abs(event1->Angle() - event2->Angle());
-      if (dv > fMaxDiffVz) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Vz = %f", event1->ID(), event2->ID(), dv));
-         return kFALSE;
-      }
-      if (dm > fMaxDiffMult ) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Mult = %f", event1->ID(), event2->ID(), dm));
-         return kFALSE;
-      }
-      if (da > fMaxDiffAngle) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Angle = %f", event1->ID(), event2->ID(), da));
-         return kFALSE;
-      }
+      dv = TMath::Abs(vz1    - vz2   );
+      dm = TMath::Abs(mult1  - mult2 );
+      da = TMath::Abs(angle1 - angle2);
+      if (dv > fMaxDiffVz) return kFALSE;
+      if (dm > fMaxDiffMult ) return kFALSE;
+      if (da > fMaxDiffAngle) return kFALSE;
       return kTRUE;
    } else {
-      ivz1 = (Int_t)(event1->Vz() / fMaxDiffVz);
-      ivz2 = (Int_t)(event2->Vz() / fMaxDiffVz);
-      imult1 = (Int_t)(event1->Mult() / fMaxDiffMult);
-      imult2 = (Int_t)(event2->Mult() / fMaxDiffMult);
-      iangle1 = (Int_t)(event1->Angle() / fMaxDiffAngle);
-      iangle2 = (Int_t)(event2->Angle() / fMaxDiffAngle);
+      ivz1 = (Int_t)(vz1 / fMaxDiffVz);
+      ivz2 = (Int_t)(vz2 / fMaxDiffVz);
+      imult1 = (Int_t)(mult1 / fMaxDiffMult);
+      imult2 = (Int_t)(mult2 / fMaxDiffMult);
+      iangle1 = (Int_t)(angle1 / fMaxDiffAngle);
+      iangle2 = (Int_t)(angle2 / fMaxDiffAngle);
       if (ivz1 != ivz2) return kFALSE;
       if (imult1 != imult2) return kFALSE;
       if (iangle1 != iangle2) return kFALSE;
@@ -1452,6 +1548,81 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::GetMixCell(Float_t vz, Float_t mult, Float_t angle, Int_t *cell) const
+{
+//
+// Cell of the mixing index for the given keys.
+// For binned mixing this is the mixing bin itself.
+// For continuous mixing the cell size is (slightly above) the allowed difference,
+// so that all the matches of an event are in its cell or in the neighbouring ones.
+//
+
+   Double_t val[3]  = {vz, mult, angle};
+   Double_t diff[3] = {fMaxDiffVz, fMaxDiffMult, fMaxDiffAngle};
+
+   for (Int_t i = 0; i < 3; i++) {
+      if (diff[i] <= 0.0) {
+         cell[i] = 0;
+      } else if (!fContinuousMix) {
+         cell[i] = (Int_t)(val[i] / diff[i]);
+      } else {
+         Double_t x = TMath::Floor(val[i] / (diff[i] * 1.0001));
+         cell[i] = (Int_t)TMath::Max(-1E9, TMath::Min(1E9, x));
+      }
+   }
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniAnalysisTask::NextMixEntry(std::vector<Int_t> &next, Int_t pos)
+{
+//
+// First entry of a cell list at or after 'pos' which can still be used for mixing
+// (the list size if none), following and compressing the links of the removed entries
+//
+
+   Int_t last = pos;
+   while (next[last] != last) last = next[last];
+   while (next[pos] != last) {
+      Int_t tmp = next[pos];
+      next[pos] = last;
+      pos = tmp;
+   }
+   return last;
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniEvent *AliRsnMiniAnalysisTask::GetBufferedEvent(Int_t ientry, Int_t pinned, Int_t maxSize, std::map<Int_t, AliRsnMiniEvent *> &cache, std::deque<Int_t> &fifo)
+{
+//
+// Returns a copy of the mini-event stored at entry 'ientry' of the buffer,
+// reading it only if not yet in the cache.
+// When the cache is full the oldest events are dropped, except the 'pinned' one.
+//
+
+   std::map<Int_t, AliRsnMiniEvent *>::iterator it = cache.find(ientry);
+   if (it != cache.end()) return it->second;
+
+   if (maxSize < 2) maxSize = 2;
+   while ((Int_t)cache.size() >= maxSize) {
+      Int_t iold = fifo.front();
+      fifo.pop_front();
+      if (iold == pinned) {
+         fifo.push_back(iold);
+         continue;
+      }
+      it = cache.find(iold);
+      delete it->second;
+      cache.erase(it);
+   }
+
+   fEvBuffer->GetEntry(ientry);
+   AliRsnMiniEvent *event = new AliRsnMiniEvent(*fMiniEvent);
+   cache[ientry] = event;
+   fifo.push_back(ientry);
+   return event;
+}
+
 //---------------------------------------------------------------------
 Double_t AliRsnMiniAnalysisTask::ApplyCentralityPatchPbPb2011(){
   //This part rejects randomly events such that the centrality gets flat for LHC11h Pb-Pb data
@@ -12,6 +12,10 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 //
 
+#include <map>
+#include <deque>
+#include <vector>
+
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -59,6 +63,7 @@ public:
    void                SetMaxDiffAngle(Double_t val)      {fMaxDiffAngle = val;}
    void                SetEventCuts(AliRsnCutSet *cuts)   {fEventCuts    = cuts;}
    void                SetMixPrintRefresh(Int_t n)        {fMixPrintRefresh = n;}
+   void                SetMixCacheSize(Int_t n)           {fMixCacheSize = n;}
    void                SetMaxNDaughters(Short_t n)        {fMaxNDaughters = n;}
    void                SetCheckMomentumConservation(Bool_t checkP) {fCheckP = checkP;}
    void                SetCheckFeedDown(Bool_t checkFeedDown)      {fCheckFeedDown = checkFeedDown;}
@@ -99,6 +104,10 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   Bool_t   EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const;
+   void     GetMixCell(Float_t vz, Float_t mult, Float_t angle, Int_t *cell) const;
+   static Int_t NextMixEntry(std::vector<Int_t> &next, Int_t pos);
+   AliRsnMiniEvent *GetBufferedEvent(Int_t ientry, Int_t pinned, Int_t maxSize, std::map<Int_t, AliRsnMiniEvent *> &cache, std::deque<Int_t> &fifo);
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list,
                                                         const char *subdetector,
                                                         const char *expectedstep) const;
@@ -142,6 +151,7 @@ private:
    AliRsnMiniEvent     *fMiniEvent;       //! mini-event cursor
    Bool_t               fBigOutput;       // flag if open file for output list
    Int_t                fMixPrintRefresh; // how often info in mixing part is printed
+   Int_t                fMixCacheSize;    // mixing --> mini-events kept in memory while filling (<0 = 4*fNMix, at least 2: the event being mixed and one partner)
    Short_t              fMaxNDaughters;   // maximum number of allowed mother's daughter
    Bool_t               fCheckP;          // flag to set in order to check the momentum conservation for mothers
    
@@ -154,7 +164,7 @@ private:
    Float_t              fMotherAcceptanceCutMaxEta;             // cut value to apply when selecting the mothers inside a defined acceptance
    Bool_t               fKeepMotherInAcceptance;                // flag to keep also mothers in acceptance
 
-   ClassDef(AliRsnMiniAnalysisTask, 13);   // AliRsnMiniAnalysisTask
+   ClassDef(AliRsnMiniAnalysisTask, 14);   // AliRsnMiniAnalysisTask
 };
 
 
@@ -50,6 +50,8 @@
 #include "TFile.h"
 #include "TMatrixD.h"
 #include "TRandom3.h"
+#include "TF1.h"
+#include "TBranch.h"
 
 #include "AliHeader.h"  
 #include "AliGenEventHeader.h"  
@@ -115,6 +117,11 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fLowPtV0DownscaligF(0)
   , fFriendDownscaling(-3.)   
   , fProcessAll(kFALSE)
+  , fDeterministicDownscaling(kFALSE)
+  , fTrackAcceptance(0)
+  , fEventHash(0)
+  , fTreeCompression("")
+  , fTreeCompressionMap()
   , fProcessCosmics(kFALSE)
   , fProcessITSTPCmatchOut(kFALSE)  // swittch to process ITS/TPC standalone tracks
   , fHighPtTree(0)
@@ -157,6 +164,7 @@ AliAnalysisTaskFilteredTree::~AliAnalysisTaskFilteredTree()
   delete fFilteredTreeAcceptanceCuts;
   delete fFilteredTreeRecAcceptanceCuts;
   delete fEsdTrackCuts;
+  delete fTrackAcceptance;
 }
 
 //____________________________________________________________________________
@@ -207,6 +215,17 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
   fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
   fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
 
+  // per tree compression settings, applied once the branches exist
+  fTreeCompressionMap.clear();
+  TObjArray *settings = fTreeCompression.Tokenize(",");
+  for (Int_t i=0; i<settings->GetEntriesFast(); i++){
+    TString setting = settings->At(i)->GetName();
+    Int_t pos = setting.Last(':');
+    if (pos<=0) continue;
+    fTreeCompressionMap[TString(setting(0,pos)).Data()] = TString(setting(pos+1,setting.Length())).Atoi();
+  }
+  delete settings;
+
   if (!fDummyTrack)  {
     fDummyTrack=new AliESDtrack();
   }
@@ -358,6 +377,7 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
     fFriendDownscaling=env.Atof();
     AliInfo(Form(" fFriendDownscaling=%f",fFriendDownscaling));
   }
+  if (fDeterministicDownscaling) UpdateEventHash(fESD);
   //
   //
   //
@@ -374,9 +394,97 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
   if (fProcessCosmics) { ProcessCosmics(fESD,fESDfriend); }
   if(fMC) { ProcessMCEff(fESD,fMC,fESDfriend);}
   if (fProcessITSTPCmatchOut) ProcessITSTPCmatchOut(fESD, fESDfriend);
+  if (!fTreeCompressionMap.empty()) ApplyTreeCompression();
   printf("processed event %d\n", Int_t(Entry()));
 }
 
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::SetTreeCompression(const char *treeName, Int_t compressionSettings)
+{
+  //
+  // Compression settings (algorithm*100+level) for one of the output trees
+  // e.g. SetTreeCompression("highPt",404) - LZ4, faster than the default ZLIB
+  // on the worker, at the price of a larger output
+  //
+  if (!fTreeCompression.IsNull()) fTreeCompression+=",";
+  fTreeCompression+=Form("%s:%d",treeName,compressionSettings);
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::ApplyTreeCompression()
+{
+  //
+  // The branches of the TTreeSRedirector trees are created at the first fill,
+  // the compression settings are applied as soon as the tree has entries
+  // (before the first basket is written)
+  //
+  std::map<std::string,Int_t>::iterator it=fTreeCompressionMap.begin();
+  while (it!=fTreeCompressionMap.end()){
+    TTree * tree = ((*fTreeSRedirector)<<it->first.c_str()).GetTree();
+    if (!tree || tree->GetEntries()==0) { ++it; continue; }
+    TIter next(tree->GetListOfBranches());
+    while (TBranch *branch = (TBranch*)next()) branch->SetCompressionSettings(it->second);
+    AliInfo(Form("tree %s: compression settings %d",it->first.c_str(),it->second));
+    fTreeCompressionMap.erase(it++);
+  }
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::UpdateEventHash(AliESDEvent *const esdEvent)
+{
+  //
+  // Event identifier used for the deterministic downscaling:
+  // global id (period, orbit, bunch crossing) and run number for the real data,
+  // chunk name and event number in file if the global id is not available (MC)
+  //
+  ULong64_t orbitID      = (ULong64_t)esdEvent->GetOrbitNumber();
+  ULong64_t bunchCrossID = (ULong64_t)esdEvent->GetBunchCrossNumber();
+  ULong64_t periodID     = (ULong64_t)esdEvent->GetPeriodNumber();
+  ULong64_t gid          = ((periodID << 36) | (orbitID << 12) | bunchCrossID); 
+  if (gid==0) gid = (ULong64_t(fCurrentFileName.String().Hash())<<24) ^ ULong64_t(esdEvent->GetEventNumberInFile());
+  fEventHash = HashMix(gid ^ (ULong64_t(esdEvent->GetRunNumber())<<40));
+}
+
+//_____________________________________________________________________________
+ULong64_t AliAnalysisTaskFilteredTree::HashMix(ULong64_t x)
+{
+  //
+  // 64 bit mixing function (splitmix64 finalizer)
+  //
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+//_____________________________________________________________________________
+Double_t AliAnalysisTaskFilteredTree::GetDownscaleRndm(Int_t id, Int_t type) const
+{
+  //
+  // Uniform number in [0,1) used in the downscaling decisions
+  // Deterministic mode: function of the event identifier, of the object index (id)
+  // and of the kind of decision (type), the filtering is then reproducible
+  // independently of the processing order and of the other tasks using gRandom
+  //
+  if (!fDeterministicDownscaling) return gRandom->Rndm();
+  ULong64_t key = HashMix(fEventHash ^ ((ULong64_t(type)<<32) | UInt_t(id)));
+  return (key >> 11)*(1./9007199254740992.);   // 53 bits mantissa
+}
+
+//_____________________________________________________________________________
+Bool_t AliAnalysisTaskFilteredTree::IsTrackDownscaled(Double_t pt, Int_t id)
+{
+  //
+  // Downscale low pt tracks (or MC particles)
+  // acceptance probability fTrackAcceptance(pt) if defined,
+  // min(1,exp(2*min(pt,10))/fLowPtTrackDownscaligF) otherwise
+  //
+  Double_t rndm = GetDownscaleRndm(id,kDownscaleTrack);
+  if (fTrackAcceptance) return rndm>=fTrackAcceptance->Eval(pt);
+  Double_t scalempt= TMath::Min(pt,10.);
+  return TMath::Exp(2*scalempt)<rndm*fLowPtTrackDownscaligF;
+}
+
 //_____________________________________________________________________________
 void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliESDfriend* esdFriend)
 {
@@ -483,7 +591,7 @@ void AliAnalysisTaskFilteredTree::ProcessCosmics(AliESDEvent *const event, AliES
       AliESDfriendTrack *friendTrackStore0=friendTrack0;    // store friend track0 for later processing
       AliESDfriendTrack *friendTrackStore1=friendTrack1;    // store friend track1 for later processing
       if (fFriendDownscaling>=1){  // downscaling number of friend tracks
-	if (gRandom->Rndm()>1./fFriendDownscaling){
+	if (GetDownscaleRndm(itrack0*ntracks+itrack1,kDownscaleFriend)>1./fFriendDownscaling){
 	  friendTrackStore0 = 0;
 	  friendTrackStore1 = 0;
 	}
@@ -685,10 +793,7 @@ void AliAnalysisTaskFilteredTree::Process(AliESDEvent *const esdEvent, AliMCEven
       if(!accCuts->AcceptTrack(track)) continue;
 
       // downscale low-pT tracks
-      Double_t scalempt= TMath::Min(track->Pt(),10.);
-      Double_t downscaleF = gRandom->Rndm();
-      downscaleF *= fLowPtTrackDownscaligF;
-      if( downscaleCounter>0 && TMath::Exp(2*scalempt)<downscaleF) continue;
+      if( downscaleCounter>0 && IsTrackDownscaled(track->Pt(),iTrack)) continue;
       //printf("TMath::Exp(2*scalempt) %e, downscaleF %e \n",TMath::Exp(2*scalempt), downscaleF);
 
       AliExternalTrackParam * tpcInner = (AliExternalTrackParam *)(track->GetTPCInnerParam());
@@ -761,7 +866,7 @@ void AliAnalysisTaskFilteredTree::ProcessLaser(AliESDEvent *const esdEvent, AliM
       AliESDfriendTrack* friendTrack=NULL;
       // suppress beam background and CE random reacks
       if (track->GetInnerParam()->Pt()<kMinPt) continue;
-      Bool_t skipTrack=gRandom->Rndm()>1/(1+TMath::Abs(fFriendDownscaling));
+      Bool_t skipTrack=GetDownscaleRndm(iTrack,kDownscaleLaser)>1/(1+TMath::Abs(fFriendDownscaling));
       if (skipTrack) continue;
       if (esdFriend) {if (!esdFriend->TestSkipBit()) friendTrack = esdFriend->GetTrack(iTrack);} //this guy can be NULL      
       (*fTreeSRedirector)<<"Laser"<<
@@ -982,10 +1087,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
       if(!accCuts->AcceptTrack(track)) continue;
 
       // downscale low-pT tracks
-      Double_t scalempt= TMath::Min(track->Pt(),10.);
-      Double_t downscaleF = gRandom->Rndm();
-      downscaleF *= fLowPtTrackDownscaligF;
-      if( downscaleCounter>0 && TMath::Exp(2*scalempt)<downscaleF) continue;
+      if( downscaleCounter>0 && IsTrackDownscaled(track->Pt(),iTrack)) continue;
       //printf("TMath::Exp(2*scalempt) %e, downscaleF %e \n",TMath::Exp(2*scalempt), downscaleF);
 
       // Dump to the tree 
@@ -1330,7 +1432,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
           track->GetImpactParametersTPC(dcaTPC[0],dcaTPC[1]);
           Bool_t isRoughPrimary = TMath::Abs(dcaTPC[1])<10;
           Bool_t hasOuter=(track->IsOn(AliVTrack::kITSin))||(track->IsOn(AliVTrack::kTOFout))||(track->IsOn(AliVTrack::kTRDin));
-          Bool_t keepPileUp=gRandom->Rndm()<0.05;
+          Bool_t keepPileUp=GetDownscaleRndm(iTrack,kDownscalePileUp)<0.05;
           if ( (!hasOuter) && (!isRoughPrimary) && (!keepPileUp)){
             dumpToTree=kFALSE;
           }
@@ -1357,7 +1459,7 @@ void AliAnalysisTaskFilteredTree::ProcessAll(AliESDEvent *const esdEvent, AliMCE
         if (!track) {track=fDummyTrack;}
 	AliESDfriendTrack *friendTrackStore=friendTrack;    // store friend track for later processing
 	if (fFriendDownscaling>=1){  // downscaling number of friend tracks
-	  friendTrackStore = (gRandom->Rndm()<1./fFriendDownscaling)? friendTrack:0;
+	  friendTrackStore = (GetDownscaleRndm(iTrack,kDownscaleFriend)<1./fFriendDownscaling)? friendTrack:0;
 	}
 	if (fFriendDownscaling<=0){
 	  if (((*fTreeSRedirector)<<"highPt").GetTree()){
@@ -1687,10 +1789,7 @@ void AliAnalysisTaskFilteredTree::ProcessMCEff(AliESDEvent *const esdEvent, AliM
       if(!prim) continue;
 
       // downscale low-pT particles
-      Double_t scalempt= TMath::Min(particle->Pt(),10.);
-      Double_t downscaleF = gRandom->Rndm();
-      downscaleF *= fLowPtTrackDownscaligF;
-      if (downscaleCounter>0 && TMath::Exp(2*scalempt)<downscaleF) continue;
+      if (downscaleCounter>0 && IsTrackDownscaled(particle->Pt(),iMc)) continue;
       // is particle in acceptance
       if(!accCuts->AcceptTrack(particle)) continue;
 
@@ -1957,7 +2056,7 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
       AliESDfriendTrack *friendTrackStore0=friendTrack0;    // store friend track0 for later processing
       AliESDfriendTrack *friendTrackStore1=friendTrack1;    // store friend track1 for later processing
       if (fFriendDownscaling>=1){  // downscaling number of friend tracks
-	if (gRandom->Rndm()>1./fFriendDownscaling){
+	if (GetDownscaleRndm(iv0,kDownscaleV0Friend)>1./fFriendDownscaling){
 	  friendTrackStore0 = 0;
 	  friendTrackStore1 = 0;
 	}
@@ -1980,7 +2079,7 @@ void AliAnalysisTaskFilteredTree::ProcessV0(AliESDEvent *const esdEvent, AliMCEv
       }
 
       //
-      Bool_t isDownscaled = IsV0Downscaled(v0);
+      Bool_t isDownscaled = IsV0Downscaled(v0,iv0);
       if (downscaleCounter>0 && isDownscaled) continue;
       AliKFParticle kfparticle; //
       Int_t type=GetKFParticle(v0,esdEvent,kfparticle);
@@ -2314,15 +2413,16 @@ Int_t   AliAnalysisTaskFilteredTree::GetKFParticle(AliESDv0 *const v0, AliESDEve
 }
 
 //_____________________________________________________________________________
-Bool_t AliAnalysisTaskFilteredTree::IsV0Downscaled(AliESDv0 *const v0)
+Bool_t AliAnalysisTaskFilteredTree::IsV0Downscaled(AliESDv0 *const v0, Int_t id)
 {
   //
   // Downscale randomly low pt V0
+  // id - index of the V0 used by the deterministic downscaling
   //
   //return kFALSE;
   Double_t maxPt= TMath::Max(v0->GetParamP()->Pt(), v0->GetParamN()->Pt());
   Double_t scalempt= TMath::Min(maxPt,10.);
-  Double_t downscaleF = gRandom->Rndm();
+  Double_t downscaleF = GetDownscaleRndm(id,kDownscaleV0);
   downscaleF *= fLowPtV0DownscaligF;
   //
   // Special treatment of the gamma conversion pt spectra is softer - 
@@ -30,6 +30,10 @@ class TTree;
 class TTreeSRedirector;
 class TParticle;
 class TH3D;
+class TF1;
+
+#include <map>
+#include <string>
 
 #include "AliTriggerAnalysis.h"
 #include "AliAnalysisTaskSE.h"
@@ -93,12 +97,21 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
 
   // v0s selection
   Int_t  GetKFParticle(AliESDv0 *const v0, AliESDEvent * const event, AliKFParticle & kfparticle);
-  Bool_t IsV0Downscaled(AliESDv0 *const v0);
+  Bool_t IsV0Downscaled(AliESDv0 *const v0, Int_t id=-1);
+  Bool_t IsTrackDownscaled(Double_t pt, Int_t id=-1);
   Bool_t IsHighDeDxParticle(AliESDtrack * const track);
 
   void SetLowPtTrackDownscaligF(Double_t fact) { fLowPtTrackDownscaligF = fact; }
   void SetLowPtV0DownscaligF(Double_t fact)    { fLowPtV0DownscaligF = fact; }
   void SetFriendDownscaling(Double_t fact)    { fFriendDownscaling = fact; }
+  // reproducible downscaling: decisions from a hash of the event identifier and of the track/V0 index
+  void SetDeterministicDownscaling(Bool_t flag=kTRUE) { fDeterministicDownscaling = flag; }
+  Bool_t IsDeterministicDownscaling() const  { return fDeterministicDownscaling; }
+  // optional pt dependent acceptance probability of the low pt tracks (replaces fLowPtTrackDownscaligF), the task takes ownership
+  void SetTrackAcceptance(TF1 *acceptance)   { fTrackAcceptance = acceptance; }
+  TF1* GetTrackAcceptance() const            { return fTrackAcceptance; }
+  // compression settings (algorithm*100+level) per output tree
+  void SetTreeCompression(const char *treeName, Int_t compressionSettings);
   
   void   SetProcessCosmics(Bool_t flag) { fProcessCosmics = flag; }
   Bool_t GetProcessCosmics() { return fProcessCosmics; }
@@ -116,6 +129,11 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   void FillHistograms(AliESDtrack* const ptrack, AliExternalTrackParam* const ptpcInnerC, Double_t centralityF, Double_t chi2TPCInnerC);
   static void SetDefaultAliasesV0(TTree *treeV0);
  private:
+  enum EDownscaleType { kDownscaleTrack=1, kDownscaleV0, kDownscaleFriend, kDownscaleV0Friend, kDownscaleLaser, kDownscalePileUp };
+  void UpdateEventHash(AliESDEvent *const esdEvent);
+  Double_t GetDownscaleRndm(Int_t id, Int_t type) const;
+  static ULong64_t HashMix(ULong64_t x);
+  void ApplyTreeCompression();
 
   AliESDEvent *fESD;    //! ESD event
   AliMCEvent *fMC;      //! MC event
@@ -143,6 +161,11 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   Double_t fLowPtV0DownscaligF;    // low pT V0 downscaling factor
   Double_t fFriendDownscaling;     // friend info downscaling )absolute value used), Modes>=1 downscaling in respect to the amount of tracks, Mode<=-1 (downscaling in respect to the data volume)
   Double_t fProcessAll; // Calculate all track properties including MC
+  Bool_t fDeterministicDownscaling; // downscaling decisions from the event/track identifiers instead of gRandom
+  TF1 *fTrackAcceptance;           // optional pt dependent acceptance probability of the tracks
+  ULong64_t fEventHash;            //! hash of the current event identifier
+  TString fTreeCompression;        // per tree compression settings "tree:settings,tree:settings"
+  std::map<std::string,Int_t> fTreeCompressionMap; //! compression settings not yet applied
   
   Bool_t fProcessCosmics; // look for cosmic pairs from random trigger
   Bool_t fProcessITSTPCmatchOut;  // swittch to process ITS/TPC standalone tracks
@@ -170,7 +193,7 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
 
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 2); // example of analysis
 };
 
 #endif
@@ -47,6 +47,7 @@
 #pragma link C++ class AliPerformanceDEdx+;
 #pragma link C++ class AliPerformanceDCA+;
 #pragma link C++ class AliPerformanceTPC+;
+#pragma link C++ class AliPerformanceTPCTrackStats+;
 #pragma link C++ class AliPerformanceMC+;
 #pragma link C++ class AliPerformanceMatch+;
 #pragma link C++ class AliPerformancePtCalib+;
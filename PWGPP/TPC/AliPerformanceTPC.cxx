@@ -48,6 +48,7 @@
 #include "TSystem.h"
 
 #include "AliPerformanceTPC.h" 
+#include "AliPerformanceTPCTrackStats.h"
 #include "AliESDEvent.h" 
 #include "AliESDVertex.h"
 #include "AliESDtrack.h"
@@ -113,7 +114,8 @@ AliPerformanceTPC::AliPerformanceTPC(const Char_t* name, const Char_t* title,Int
   // histogram folder 
   fAnalysisFolder(0),
   
-  fUseHLT(kFALSE)
+  fUseHLT(kFALSE),
+  fTPCTrackStats(0)
 
 {
   // named constructor	
@@ -135,6 +137,39 @@ AliPerformanceTPC::~AliPerformanceTPC()
   if(fTPCTrackHisto) delete fTPCTrackHisto; fTPCTrackHisto=0;   
   if(fAnalysisFolder) delete fAnalysisFolder; fAnalysisFolder=0;
   if(fFolderObj) delete fFolderObj; fFolderObj=0;
+  if(fTPCTrackStats) delete fTPCTrackStats; fTPCTrackStats=0;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceTPC::SetUseSummaryMode(Bool_t summaryMode)
+{
+  // In summary mode the track observables are kept as mean/variance per
+  // (eta,phi,pt,charge) cell and as fixed binning distributions per
+  // (eta,charge) cell (AliPerformanceTPCTrackStats). fTPCTrackHisto stays
+  // empty, which saves most of the memory and of the merging time.
+  // Only tracks from events with reconstructed vertex are summarised.
+  // The cluster and event histograms are not affected.
+  if (summaryMode && !fTPCTrackStats) {
+    Double_t scaleDCA = (fAnalysisMode !=0) ? 0.1 : 1.0;
+    Double_t ptMax = IsHptGenerator() ? 100. : 20.;
+    fTPCTrackStats = new AliPerformanceTPCTrackStats("fTPCTrackStats",30,18,10,0.1,ptMax,3.*scaleDCA);
+  }
+  if (!summaryMode && fTPCTrackStats) {
+    delete fTPCTrackStats; fTPCTrackStats=0;
+  }
+}
+
+//_____________________________________________________________________________
+void AliPerformanceTPC::FillTrack(const Double_t *vTPCTrackHisto)
+{
+  // fill the track observables
+  // nClust:chi2PerClust:nClust/nFindableClust:DCAr:DCAz:eta:phi:pt:charge:vertStatus
+  if (!fTPCTrackStats) {
+    fTPCTrackHisto->Fill(vTPCTrackHisto);
+    return;
+  }
+  if (vTPCTrackHisto[9] < 0.5) return;
+  fTPCTrackStats->Fill(vTPCTrackHisto[5],vTPCTrackHisto[6],vTPCTrackHisto[7],vTPCTrackHisto[8],vTPCTrackHisto);
 }
 
 
@@ -349,7 +384,7 @@ void AliPerformanceTPC::ProcessTPC(AliStack* const stack, AliESDtrack *const esd
 
   //Double_t vTPCTrackHisto[10] = {nClust,chi2PerCluster,clustPerFindClust,dca[0],dca[1],eta,phi,pt,qpt,vertStatus};
   Double_t vTPCTrackHisto[10] = {static_cast<Double_t>(nClust),static_cast<Double_t>(chi2PerCluster),static_cast<Double_t>(clustPerFindClust),static_cast<Double_t>(dca[0]),static_cast<Double_t>(dca[1]),static_cast<Double_t>(eta),static_cast<Double_t>(phi),static_cast<Double_t>(pt),static_cast<Double_t>(q),static_cast<Double_t>(vertStatus)};
-  fTPCTrackHisto->Fill(vTPCTrackHisto); 
+  FillTrack(vTPCTrackHisto);
  
   //
   // Fill rec vs MC information
@@ -420,7 +455,7 @@ void AliPerformanceTPC::ProcessTPCITS(AliStack* const stack, AliESDtrack *const
   if(!fCutsRC->GetDCAToVertex2D() && TMath::Abs(dca[1]) > fCutsRC->GetMaxDCAToVertexZ()) return;
 
   Double_t vTPCTrackHisto[10] = {static_cast<Double_t>(nClust),static_cast<Double_t>(chi2PerCluster),static_cast<Double_t>(clustPerFindClust),static_cast<Double_t>(dca[0]),static_cast<Double_t>(dca[1]),static_cast<Double_t>(eta),static_cast<Double_t>(phi),static_cast<Double_t>(pt),static_cast<Double_t>(q),static_cast<Double_t>(vertStatus)};
-  fTPCTrackHisto->Fill(vTPCTrackHisto); 
+  FillTrack(vTPCTrackHisto);
  
   //
   // Fill rec vs MC information
@@ -672,6 +707,14 @@ void AliPerformanceTPC::Analyse()
     //
     // Track histograms 
     // 
+    // summary mode: track observables are analysed in AliTPCPerformanceSummary::AnalyzeTrackStats
+    if (fTPCTrackStats) {
+      fAnalysisFolder = ExportToFolder(aFolderObj);
+      if (fFolderObj) delete fFolderObj;
+      fFolderObj = aFolderObj;
+      return;
+    }
+
     // all with vertex
     fTPCTrackHisto->GetAxis(8)->SetRangeUser(-1.5,1.5);
     fTPCTrackHisto->GetAxis(9)->SetRangeUser(0.5,1.5);
@@ -798,6 +841,8 @@ Long64_t AliPerformanceTPC::Merge(TCollection* const list)
         if ((fTPCEventHisto) && (entry->fTPCEventHisto)) { fTPCEventHisto->Add(entry->fTPCEventHisto); }
         if ((fTPCTrackHisto) && (entry->fTPCTrackHisto)) { fTPCTrackHisto->Add(entry->fTPCTrackHisto); }
     }
+    // the summary is small, it is always merged
+    if ((fTPCTrackStats) && (entry->fTPCTrackStats)) { fTPCTrackStats->Add(entry->fTPCTrackStats); }
     // the analysisfolder is only merged if present
     if (entry->fFolderObj) { objArrayList->Add(entry->fFolderObj); }
 
@@ -24,6 +24,7 @@ class AliESDEvent;
 class AliESDfriend; 
 class AliMCInfoCuts;
 class AliRecInfoCuts;
+class AliPerformanceTPCTrackStats;
 
 #include "THnSparse.h"
 #include "AliPerformanceObject.h"
@@ -84,6 +85,12 @@ public :
   void SetUseHLT(Bool_t useHLT = kTRUE) {fUseHLT = useHLT;}
   Bool_t GetUseHLT() { return fUseHLT; }
 
+  // summary mode: keep the track observables in AliPerformanceTPCTrackStats
+  // instead of filling fTPCTrackHisto
+  void SetUseSummaryMode(Bool_t summaryMode = kTRUE);
+  Bool_t IsSummaryMode() const { return fTPCTrackStats!=0; }
+  AliPerformanceTPCTrackStats *GetTPCTrackStats() const { return fTPCTrackStats; }
+
 
 private:
 
@@ -105,10 +112,15 @@ private:
 
   Bool_t fUseHLT; // use HLT ESD
 
+  AliPerformanceTPCTrackStats *fTPCTrackStats; // track observables summary (summary mode only)
+
+  // fill the track observables (histogram or summary)
+  void FillTrack(const Double_t *vTPCTrackHisto);
+
   AliPerformanceTPC(const AliPerformanceTPC&); // not implemented
   AliPerformanceTPC& operator=(const AliPerformanceTPC&); // not implemented
 
-  ClassDef(AliPerformanceTPC,11);
+  ClassDef(AliPerformanceTPC,12);
 };
 
 #endif
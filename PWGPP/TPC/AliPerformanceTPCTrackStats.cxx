@@ -0,0 +1,297 @@
+//------------------------------------------------------------------------------
+// Implementation of AliPerformanceTPCTrackStats class. It keeps a compact
+// summary of the TPC track observables (number of clusters, chi2 per
+// cluster, found/findable clusters, DCAr, DCAz):
+//
+//  - per (eta, phi, pt, charge) cell the number of tracks and the running
+//    mean and variance of each observable (Welford update, merged with the
+//    pairwise formula of Chan et al.),
+//  - per (eta, charge) cell a fixed binning distribution of each observable
+//    in the pt range used by the trending (quantile sketch). With fixed edges
+//    the sketches are merged exactly by adding the bin contents.
+//
+// The memory footprint is independent of the statistics and the merging
+// cost is linear in the number of cells, which allows full statistics QA
+// without the 10-D THnSparse. The trending variables are extracted in
+// AliTPCPerformanceSummary::AnalyzeTrackStats().
+//
+//  AliPerformanceTPCTrackStats* stats = pTPC->GetTPCTrackStats();
+//  Double_t mean, rms;
+//  stats->GetStats(AliPerformanceTPCTrackStats::kNClust, mean, rms, -1, 1, 0.25, 10);
+//  Double_t median = stats->GetQuantile(AliPerformanceTPCTrackStats::kNClust, 0.5);
+//------------------------------------------------------------------------------
+
+#include "TCollection.h"
+#include "TH1D.h"
+#include "TMath.h"
+
+#include "AliPerformanceTPCTrackStats.h"
+
+ClassImp(AliPerformanceTPCTrackStats)
+
+//_____________________________________________________________________________
+AliPerformanceTPCTrackStats::AliPerformanceTPCTrackStats(const Char_t* name, Int_t nEta, Int_t nPhi, Int_t nPt, Double_t ptMin, Double_t ptMax, Double_t dcaRange):
+  TNamed(name,"TPC track observables summary"),
+  fNEta(nEta),
+  fNPhi(nPhi),
+  fNPt(nPt),
+  fPtEdges(nPt+1),
+  fSketchPtMin(0.25),
+  fSketchPtMax(10.),
+  fNTracks(0),
+  fCount(),
+  fMean(),
+  fM2(),
+  fSketch()
+{
+  // constructor
+  // the sketch ranges are the ones of the fTPCTrackHisto axes
+  //
+  Double_t logMin = TMath::Log10(ptMin);
+  Double_t logMax = TMath::Log10(ptMax);
+  for (Int_t i=0; i<=fNPt; i++) fPtEdges[i] = TMath::Power(10.,logMin+i*(logMax-logMin)/fNPt);
+
+  fObsMin[kNClust] = 0.;              fObsMax[kNClust] = 160.;
+  fObsMin[kChi2PerClust] = 0.;        fObsMax[kChi2PerClust] = 5.;
+  fObsMin[kClustPerFindClust] = 0.;   fObsMax[kClustPerFindClust] = 1.2;
+  fObsMin[kDCAr] = -dcaRange;         fObsMax[kDCAr] = dcaRange;
+  fObsMin[kDCAz] = -dcaRange;         fObsMax[kDCAz] = dcaRange;
+
+  Int_t nCells = 2*fNEta*fNPhi*fNPt;
+  fCount.Set(nCells);
+  fMean.Set(nCells*kNObservables);
+  fM2.Set(nCells*kNObservables);
+  fSketch.Set(2*fNEta*kNObservables*fgkNSketchBins);
+}
+
+//_____________________________________________________________________________
+const char* AliPerformanceTPCTrackStats::GetObservableName(Int_t obs)
+{
+  // name used for the histograms
+  static const char* names[kNObservables] = {"nClust","chi2PerClust","nClustPerFindClust","DCAr","DCAz"};
+  if (obs<0 || obs>=kNObservables) return "";
+  return names[obs];
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceTPCTrackStats::GetEtaBin(Double_t eta) const
+{
+  // eta bin in [-1.5,1.5], -1 if outside
+  if (eta<-1.5 || eta>=1.5) return -1;
+  return TMath::Min(Int_t((eta+1.5)/3.*fNEta),fNEta-1);
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceTPCTrackStats::GetPhiBin(Double_t phi) const
+{
+  // phi bin in [0,2pi], phi is folded
+  Double_t twoPi = 2.*TMath::Pi();
+  if (phi<0) phi += twoPi;
+  if (phi>=twoPi) phi -= twoPi;
+  return TMath::Min(TMath::Max(Int_t(phi/twoPi*fNPhi),0),fNPhi-1);
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceTPCTrackStats::GetPtBin(Double_t pt) const
+{
+  // logarithmic pt bin, -1 if outside
+  if (pt<fPtEdges[0] || pt>=fPtEdges[fNPt]) return -1;
+  return TMath::Min(Int_t(TMath::BinarySearch(fNPt+1,fPtEdges.GetArray(),pt)),fNPt-1);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceTPCTrackStats::Fill(Double_t eta, Double_t phi, Double_t pt, Double_t charge, const Double_t* obs)
+{
+  // add one track
+  //
+  Int_t iEta = GetEtaBin(eta);
+  Int_t iPt = GetPtBin(pt);
+  if (iEta<0 || iPt<0 || charge==0) return;
+  Int_t iCharge = (charge>0) ? 0 : 1;
+  Int_t cell = GetCell(iEta,GetPhiBin(phi),iPt,iCharge);
+
+  Double_t n = fCount[cell] + 1.;
+  fCount[cell] = n;
+  fNTracks++;
+  for (Int_t i=0; i<kNObservables; i++) {
+    Int_t idx = cell*kNObservables + i;
+    Double_t delta = obs[i] - fMean[idx];
+    fMean[idx] += delta/n;
+    fM2[idx] += delta*(obs[i]-fMean[idx]);
+  }
+
+  if (pt<fSketchPtMin || pt>fSketchPtMax) return;
+  for (Int_t i=0; i<kNObservables; i++) {
+    if (obs[i]<fObsMin[i] || obs[i]>=fObsMax[i]) continue;
+    Int_t bin = Int_t((obs[i]-fObsMin[i])/(fObsMax[i]-fObsMin[i])*fgkNSketchBins);
+    fSketch[GetSketchOffset(iEta,iCharge,i) + TMath::Min(bin,fgkNSketchBins-1)] += 1.;
+  }
+}
+
+//_____________________________________________________________________________
+Bool_t AliPerformanceTPCTrackStats::IsCompatible(const AliPerformanceTPCTrackStats* other) const
+{
+  // same binning
+  if (!other) return kFALSE;
+  if (other->fNEta!=fNEta || other->fNPhi!=fNPhi || other->fNPt!=fNPt) return kFALSE;
+  if (other->fSketch.GetSize()!=fSketch.GetSize()) return kFALSE;
+  for (Int_t i=0; i<kNObservables; i++) {
+    if (other->fObsMin[i]!=fObsMin[i] || other->fObsMax[i]!=fObsMax[i]) return kFALSE;
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliPerformanceTPCTrackStats::Add(const AliPerformanceTPCTrackStats* other)
+{
+  // add the content of other (same binning required)
+  //
+  if (!IsCompatible(other)) {
+    Error("Add","incompatible binning, %s not added",other ? other->GetName() : "0x0");
+    return kFALSE;
+  }
+
+  Int_t nCells = fCount.GetSize();
+  for (Int_t cell=0; cell<nCells; cell++) {
+    Double_t nB = other->fCount[cell];
+    if (nB<=0) continue;
+    Double_t nA = fCount[cell];
+    Double_t n = nA + nB;
+    for (Int_t i=0; i<kNObservables; i++) {
+      Int_t idx = cell*kNObservables + i;
+      Double_t delta = other->fMean[idx] - fMean[idx];
+      fMean[idx] += delta*nB/n;
+      fM2[idx] += other->fM2[idx] + delta*delta*nA*nB/n;
+    }
+    fCount[cell] = n;
+  }
+  for (Int_t i=0; i<fSketch.GetSize(); i++) fSketch[i] += other->fSketch[i];
+  fNTracks += other->fNTracks;
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Long64_t AliPerformanceTPCTrackStats::Merge(TCollection* const list)
+{
+  // merge list of objects
+  if (!list) return 0;
+  if (list->IsEmpty()) return 1;
+
+  TIter next(list);
+  TObject* obj = 0;
+  Int_t count = 0;
+  while ((obj = next())) {
+    AliPerformanceTPCTrackStats* entry = dynamic_cast<AliPerformanceTPCTrackStats*>(obj);
+    if (!entry || entry==this) continue;
+    if (Add(entry)) count++;
+  }
+  return count;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceTPCTrackStats::Reset()
+{
+  // clear the content, keep the binning
+  fCount.Reset();
+  fMean.Reset();
+  fM2.Reset();
+  fSketch.Reset();
+  fNTracks = 0;
+}
+
+//_____________________________________________________________________________
+Double_t AliPerformanceTPCTrackStats::GetStats(Int_t obs, Double_t& mean, Double_t& rms, Double_t etaMin, Double_t etaMax, Double_t ptMin, Double_t ptMax, Int_t charge) const
+{
+  // combine the cells with bin centres inside the eta and pt ranges
+  // returns the number of tracks
+  //
+  mean = 0; rms = 0;
+  if (obs<0 || obs>=kNObservables) return 0;
+
+  Double_t n = 0, m = 0, m2 = 0;
+  for (Int_t iCharge=0; iCharge<2; iCharge++) {
+    if ((charge>0 && iCharge!=0) || (charge<0 && iCharge!=1)) continue;
+    for (Int_t iPt=0; iPt<fNPt; iPt++) {
+      Double_t pt = 0.5*(fPtEdges[iPt]+fPtEdges[iPt+1]);
+      if (pt<ptMin || pt>ptMax) continue;
+      for (Int_t iPhi=0; iPhi<fNPhi; iPhi++) {
+        for (Int_t iEta=0; iEta<fNEta; iEta++) {
+          Double_t eta = -1.5 + (iEta+0.5)*3./fNEta;
+          if (eta<etaMin || eta>etaMax) continue;
+          Int_t cell = GetCell(iEta,iPhi,iPt,iCharge);
+          Double_t nB = fCount[cell];
+          if (nB<=0) continue;
+          Int_t idx = cell*kNObservables + obs;
+          Double_t nAB = n + nB;
+          Double_t delta = fMean[idx] - m;
+          m += delta*nB/nAB;
+          m2 += fM2[idx] + delta*delta*n*nB/nAB;
+          n = nAB;
+        }
+      }
+    }
+  }
+  if (n>0) {
+    mean = m;
+    rms = TMath::Sqrt(m2/n);
+  }
+  return n;
+}
+
+//_____________________________________________________________________________
+TH1D* AliPerformanceTPCTrackStats::MakeDistribution(Int_t obs, Double_t etaMin, Double_t etaMax, Int_t charge) const
+{
+  // distribution of the observable summed over the selected sketches
+  // it is user responsibility to delete the histogram
+  //
+  if (obs<0 || obs>=kNObservables) return 0;
+  TH1D* his = new TH1D(Form("%s_%s_dist",GetName(),GetObservableName(obs)),GetObservableName(obs),fgkNSketchBins,fObsMin[obs],fObsMax[obs]);
+  his->SetDirectory(0);
+  for (Int_t iCharge=0; iCharge<2; iCharge++) {
+    if ((charge>0 && iCharge!=0) || (charge<0 && iCharge!=1)) continue;
+    for (Int_t iEta=0; iEta<fNEta; iEta++) {
+      Double_t eta = -1.5 + (iEta+0.5)*3./fNEta;
+      if (eta<etaMin || eta>etaMax) continue;
+      const Float_t* sketch = fSketch.GetArray() + GetSketchOffset(iEta,iCharge,obs);
+      for (Int_t bin=0; bin<fgkNSketchBins; bin++) {
+        if (sketch[bin]>0) his->AddBinContent(bin+1,sketch[bin]);
+      }
+    }
+  }
+  his->ResetStats();
+  return his;
+}
+
+//_____________________________________________________________________________
+Double_t AliPerformanceTPCTrackStats::GetQuantile(Int_t obs, Double_t q, Double_t etaMin, Double_t etaMax, Int_t charge) const
+{
+  // approximate quantile, linear interpolation inside the sketch bin
+  //
+  TH1D* his = MakeDistribution(obs,etaMin,etaMax,charge);
+  if (!his) return 0;
+  Double_t value = 0;
+  if (his->GetSumOfWeights()>0) his->GetQuantiles(1,&value,&q);
+  delete his;
+  return value;
+}
+
+//_____________________________________________________________________________
+TH1D* AliPerformanceTPCTrackStats::MakeEtaProfile(Int_t obs, Double_t ptMin, Double_t ptMax, Int_t charge) const
+{
+  // mean of the observable vs eta, the bin error is the error of the mean
+  // it is user responsibility to delete the histogram
+  //
+  if (obs<0 || obs>=kNObservables) return 0;
+  TH1D* his = new TH1D(Form("%s_%s_eta",GetName(),GetObservableName(obs)),GetObservableName(obs),fNEta,-1.5,1.5);
+  his->SetDirectory(0);
+  for (Int_t iEta=0; iEta<fNEta; iEta++) {
+    Double_t eta = his->GetXaxis()->GetBinCenter(iEta+1);
+    Double_t halfWidth = 0.25*his->GetXaxis()->GetBinWidth(iEta+1);
+    Double_t mean = 0, rms = 0;
+    Double_t n = GetStats(obs,mean,rms,eta-halfWidth,eta+halfWidth,ptMin,ptMax,charge);
+    if (n<2) continue;
+    his->SetBinContent(iEta+1,mean);
+    his->SetBinError(iEta+1,rms/TMath::Sqrt(n));
+  }
+  return his;
+}
@@ -0,0 +1,82 @@
+#ifndef ALIPERFORMANCETPCTRACKSTATS_H
+#define ALIPERFORMANCETPCTRACKSTATS_H
+
+//------------------------------------------------------------------------------
+// Compact, mergeable summary of the TPC track observables used for the
+// QA trending (replacement of the 10-D fTPCTrackHisto in summary mode).
+//
+// Per (eta, phi, pt, charge) cell the number of tracks and the streaming
+// mean / variance of every observable are kept. Per (eta, charge) cell a
+// fixed binning distribution of every observable is kept as quantile sketch.
+//------------------------------------------------------------------------------
+
+class TCollection;
+class TH1D;
+
+#include "TNamed.h"
+#include "TArrayD.h"
+#include "TArrayF.h"
+
+class AliPerformanceTPCTrackStats : public TNamed {
+public :
+  enum EObservable { kNClust=0, kChi2PerClust, kClustPerFindClust, kDCAr, kDCAz, kNObservables };
+
+  AliPerformanceTPCTrackStats(const Char_t* name="AliPerformanceTPCTrackStats", Int_t nEta=30, Int_t nPhi=18, Int_t nPt=10, Double_t ptMin=0.1, Double_t ptMax=20., Double_t dcaRange=3.);
+  virtual ~AliPerformanceTPCTrackStats() {;}
+
+  // Fill one track, obs has kNObservables entries
+  void Fill(Double_t eta, Double_t phi, Double_t pt, Double_t charge, const Double_t* obs);
+
+  // Merge (needed by PROOF / the analysis manager)
+  Bool_t Add(const AliPerformanceTPCTrackStats* other);
+  virtual Long64_t Merge(TCollection* const list);
+  void Reset();
+
+  // Number of tracks, mean and rms of the observable in the eta/pt range (charge 0 = both signs)
+  Double_t GetStats(Int_t obs, Double_t& mean, Double_t& rms, Double_t etaMin=-1., Double_t etaMax=1., Double_t ptMin=0., Double_t ptMax=1e3, Int_t charge=0) const;
+  // Approximate quantile from the sketch (precision: one sketch bin)
+  Double_t GetQuantile(Int_t obs, Double_t q, Double_t etaMin=-1., Double_t etaMax=1., Int_t charge=0) const;
+
+  // Distribution of the observable from the sketch (pt within the sketch range)
+  TH1D* MakeDistribution(Int_t obs, Double_t etaMin=-1., Double_t etaMax=1., Int_t charge=0) const;
+  // Mean of the observable vs eta, the error is the error of the mean
+  TH1D* MakeEtaProfile(Int_t obs, Double_t ptMin=0., Double_t ptMax=1e3, Int_t charge=0) const;
+
+  void SetSketchPtRange(Double_t ptMin, Double_t ptMax) { fSketchPtMin = ptMin; fSketchPtMax = ptMax; }
+
+  Int_t GetNEtaBins() const { return fNEta; }
+  Int_t GetNPhiBins() const { return fNPhi; }
+  Int_t GetNPtBins()  const { return fNPt; }
+  Double_t GetEntries() const { return fNTracks; }
+
+  static const char* GetObservableName(Int_t obs);
+
+private:
+  static const Int_t fgkNSketchBins = 160; // bins of the quantile sketch
+
+  Int_t GetEtaBin(Double_t eta) const;
+  Int_t GetPhiBin(Double_t phi) const;
+  Int_t GetPtBin(Double_t pt) const;
+  Int_t GetCell(Int_t iEta, Int_t iPhi, Int_t iPt, Int_t iCharge) const { return ((iCharge*fNPt + iPt)*fNPhi + iPhi)*fNEta + iEta; }
+  Int_t GetSketchOffset(Int_t iEta, Int_t iCharge, Int_t obs) const { return ((iCharge*fNEta + iEta)*kNObservables + obs)*fgkNSketchBins; }
+  Bool_t IsCompatible(const AliPerformanceTPCTrackStats* other) const;
+
+  Int_t    fNEta;          // number of eta bins in [-1.5,1.5]
+  Int_t    fNPhi;          // number of phi bins in [0,2pi]
+  Int_t    fNPt;           // number of (logarithmic) pt bins
+  TArrayD  fPtEdges;       // pt bin edges
+  Double_t fObsMin[kNObservables];  // lower edge of the sketch per observable
+  Double_t fObsMax[kNObservables];  // upper edge of the sketch per observable
+  Double_t fSketchPtMin;   // pt range of the tracks entering the sketch
+  Double_t fSketchPtMax;   // pt range of the tracks entering the sketch
+  Double_t fNTracks;       // total number of filled tracks
+
+  TArrayD  fCount;         // tracks per cell
+  TArrayD  fMean;          // running mean per cell and observable
+  TArrayD  fM2;            // sum of squared deviations per cell and observable
+  TArrayF  fSketch;        // distribution per (eta, charge) cell and observable
+
+  ClassDef(AliPerformanceTPCTrackStats,1);
+};
+
+#endif
@@ -41,6 +41,7 @@
 #include "AliTPCcalibDButil.h"
 #include "TTreeStream.h"
 #include "AliPerformanceTPC.h"
+#include "AliPerformanceTPCTrackStats.h"
 #include "AliPerformanceDEdx.h"
 #include "AliPerformanceDCA.h"
 #include "AliPerformanceMatch.h"
@@ -182,7 +183,13 @@ void AliTPCPerformanceSummary::WriteToTTreeSRedirector(const AliPerformanceTPC*
       "duration="<<duration<<
       "bz="<<bz<<
       "runType.="<<&runType;
-    if (pTPC) {
+    if (pTPC && pTPC->IsSummaryMode()) {
+        // track observables available only as summary
+        AnalyzeTrackStats(pTPC, pcstream);
+	MakeRawOCDBQAPlot(pcstream);
+        AnalyzeEvent(pTPC, pcstream);
+    }
+    else if (pTPC) {
         pTPC->GetTPCTrackHisto()->GetAxis(9)->SetRangeUser(0.5,1.5);
         pTPC->GetTPCTrackHisto()->GetAxis(7)->SetRangeUser(0.25,10);
         pTPC->GetTPCTrackHisto()->GetAxis(5)->SetRangeUser(-1,1);    
@@ -977,6 +984,115 @@ Int_t AliTPCPerformanceSummary::AnalyzeDCARPhiNeg(const AliPerformanceTPC* pTPC,
     return 0;
 }
 
+//_____________________________________________________________________________
+Int_t AliTPCPerformanceSummary::AnalyzeTrackStats(const AliPerformanceTPC* pTPC, TTreeSRedirector* const pcstream)
+{
+  //
+  // Trending variables from the track summary (AliPerformanceTPC in summary mode)
+  // Same selection as AnalyzeNCL, AnalyzeDrift and AnalyzeDCARPhi:
+  // rec. vertex, |eta|<1, 0.25<pt<10 GeV/c
+  // Differences with respect to the THnSparse based analysis:
+  //   - the eta dependence is fitted to the mean per eta bin instead of
+  //     the mean of a gaussian fit (FitSlicesY)
+  //   - the found/findable range 0.4-1.1 is applied to the distribution
+  //     but not to the mean per eta bin
+  //
+    if (!pcstream) return 1;
+    if (!pTPC) return 1;
+    const AliPerformanceTPCTrackStats* stats = pTPC->GetTPCTrackStats();
+    if (!stats) return 1;
+
+    static TVectorF infoTPCncl(5);
+    static TVectorF infoTPCnclF(5);
+    static TVectorF infoTPCChi2(5);
+    static Double_t meanTPCncl=0, rmsTPCncl=0, medianTPCncl=0;
+    static Double_t meanTPCnclF=0, rmsTPCnclF=0;
+    static Double_t meanTPCChi2=0, rmsTPCChi2=0;
+    static Double_t slopeATPCncl=0, slopeCTPCncl=0, slopeATPCnclErr=0, slopeCTPCnclErr=0;
+    static Double_t slopeATPCnclF=0, slopeCTPCnclF=0, slopeATPCnclFErr=0, slopeCTPCnclFErr=0;
+    static Double_t offsetdRA=0, slopedRA=0, offsetdRC=0, slopedRC=0;
+    static Double_t offsetdZA=0, slopedZA=0, offsetdZC=0, slopedZC=0;
+    static TF1 *fpol1 = new TF1("fpol1","pol1");
+
+    TH1* his1D = stats->MakeDistribution(AliPerformanceTPCTrackStats::kNClust,-1.,1.);
+    meanTPCncl = his1D->GetMean();
+    rmsTPCncl = his1D->GetRMS();
+    GetStatInfo(his1D,infoTPCncl,0);
+    delete his1D;
+    medianTPCncl = stats->GetQuantile(AliPerformanceTPCTrackStats::kNClust,0.5,-1.,1.);
+
+    his1D = stats->MakeDistribution(AliPerformanceTPCTrackStats::kChi2PerClust,-1.,1.);
+    meanTPCChi2 = his1D->GetMean();
+    rmsTPCChi2 = his1D->GetRMS();
+    GetStatInfo(his1D,infoTPCChi2,0);
+    delete his1D;
+
+    his1D = stats->MakeDistribution(AliPerformanceTPCTrackStats::kClustPerFindClust,-1.,1.);
+    his1D->GetXaxis()->SetRangeUser(0.4,1.1);
+    meanTPCnclF = his1D->GetMean();
+    rmsTPCnclF = his1D->GetRMS();
+    GetStatInfo(his1D,infoTPCnclF,0);
+    delete his1D;
+
+    // eta dependence: A side 0.1<eta<0.8, C side -0.8<eta<-0.1
+    Double_t* slopes[4][4] = {
+      {&slopeATPCncl,&slopeATPCnclErr,&slopeCTPCncl,&slopeCTPCnclErr},
+      {&slopeATPCnclF,&slopeATPCnclFErr,&slopeCTPCnclF,&slopeCTPCnclFErr},
+      {&offsetdRA,&slopedRA,&offsetdRC,&slopedRC},
+      {&offsetdZA,&slopedZA,&offsetdZC,&slopedZC}};
+    const Int_t obs[4] = {AliPerformanceTPCTrackStats::kNClust, AliPerformanceTPCTrackStats::kClustPerFindClust,
+                          AliPerformanceTPCTrackStats::kDCAr, AliPerformanceTPCTrackStats::kDCAz};
+    for (Int_t i=0; i<4; i++) {
+      his1D = stats->MakeEtaProfile(obs[i],0.25,10.);
+      his1D->Fit(fpol1,"QNR","QNR",0.1,0.8);
+      // slopes: (slope, error), offsets: (offset, slope)
+      *slopes[i][0] = (i<2) ? fpol1->GetParameter(1) : fpol1->GetParameter(0);
+      *slopes[i][1] = (i<2) ? fpol1->GetParError(1) : fpol1->GetParameter(1);
+      his1D->Fit(fpol1,"QNR","QNR",-0.8,-0.1);
+      *slopes[i][2] = (i<2) ? fpol1->GetParameter(1) : fpol1->GetParameter(0);
+      *slopes[i][3] = (i<2) ? fpol1->GetParError(1) : fpol1->GetParameter(1);
+      delete his1D;
+    }
+
+    printf("Track summary QA report\n");
+    printf("meanTPCncl=\t%f\n",meanTPCncl);
+    printf("medianTPCncl=\t%f\n",medianTPCncl);
+    printf("meanTPCnclF=\t%f\n",meanTPCnclF);
+    printf("meanTPCChi2=\t%f\n",meanTPCChi2);
+    printf("offsetdRA=\t%f\n",offsetdRA);
+    printf("offsetdZA=\t%f\n",offsetdZA);
+
+    (*pcstream)<<"trending"<<
+      "infoTPCnclF.="<<&infoTPCnclF <<
+      "infoTPCncl.="<<&infoTPCncl <<
+      "infoTPCchi2.="<<&infoTPCChi2 <<
+      "meanTPCnclF="<<meanTPCnclF <<
+      "rmsTPCnclF="<<rmsTPCnclF <<
+      "meanTPCChi2="<<meanTPCChi2 <<
+      "rmsTPCChi2="<<rmsTPCChi2 <<
+      "slopeATPCnclF="<< slopeATPCnclF<<
+      "slopeCTPCnclF="<< slopeCTPCnclF<<
+      "slopeATPCnclFErr="<< slopeATPCnclFErr<<
+      "slopeCTPCnclFErr="<< slopeCTPCnclFErr<<
+      "meanTPCncl="<<meanTPCncl <<
+      "rmsTPCncl="<< rmsTPCncl<<
+      "medianTPCncl="<< medianTPCncl<<
+      "slopeATPCncl="<< slopeATPCncl<<
+      "slopeCTPCncl="<< slopeCTPCncl<<
+      "slopeATPCnclErr="<< slopeATPCnclErr<<
+      "slopeCTPCnclErr="<< slopeCTPCnclErr<<
+      "offsetdRA="<< offsetdRA<<
+      "slopedRA="<< slopedRA<<
+      "offsetdRC="<< offsetdRC<<
+      "slopedRC="<< slopedRC<<
+      "offsetdZA="<< offsetdZA<<
+      "slopedZA="<< slopedZA<<
+      "offsetdZC="<< offsetdZC<<
+      "slopedZC="<< slopedZC;
+
+    return 0;
+}
+
 //_____________________________________________________________________________
 Int_t AliTPCPerformanceSummary::AnalyzeNCL(const AliPerformanceTPC* pTPC, TTreeSRedirector* const pcstream)
 {
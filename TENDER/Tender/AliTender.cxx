@@ -41,7 +41,10 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fConsumedData(AliTenderSupply::kAllData),
+           fPruneBranches(kFALSE),
+           fActiveSupplies(NULL)
 {
 // Dummy constructor
 }
@@ -58,7 +61,10 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fConsumedData(AliTenderSupply::kAllData),
+           fPruneBranches(kFALSE),
+           fActiveSupplies(NULL)
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -68,6 +74,7 @@ AliTender::AliTender(const char* name):
 AliTender::~AliTender()
 {
 // Destructor
+  delete fActiveSupplies;
   if (fSupplies) {
     fSupplies->Delete();
     delete fSupplies;
@@ -142,6 +149,45 @@ void AliTender::UserCreateOutputObjects()
      fESDhandler->SetUserCallSelectionMask(kTRUE);
      Info("UserCreateOutputObjects","The TENDER will check the event selection. Make sure you add the tender as FIRST wagon!");
   }   
+  SelectSupplies();
+}
+
+//______________________________________________________________________________
+void AliTender::SelectSupplies()
+{
+// Select the supplies contributing to the data consumed downstream. The chain
+// is walked backwards: a supply is needed if it writes data needed after it,
+// in which case the data it reads becomes needed by the supplies before it.
+// Supplies not declaring their dependencies read and write everything.
+  if (!fActiveSupplies) fActiveSupplies = new TObjArray();
+  fActiveSupplies->Clear();
+  if (!fSupplies) return;
+  UInt_t needed = fConsumedData;
+  UInt_t read = 0;
+  TObjArray active(fSupplies->GetEntriesFast());
+  for (Int_t i = fSupplies->GetEntriesFast()-1; i >= 0; i--) {
+    AliTenderSupply *supply = (AliTenderSupply*)fSupplies->At(i);
+    if (!supply) continue;
+    if (!(supply->GetWrittenData() & needed)) {
+      Info("SelectSupplies", "Tender supply %s skipped: its output is not used", supply->GetName());
+      continue;
+    }
+    active.AddAt(supply, i);
+    needed |= supply->GetReadData();
+    read |= supply->GetReadData();
+  }
+  TIter next(&active);
+  AliTenderSupply *supply;
+  while ((supply=(AliTenderSupply*)next())) fActiveSupplies->Add(supply);
+
+  if (fPruneBranches && fESDhandler && fConsumedData != AliTenderSupply::kAllData) {
+    const UInt_t unused = AliTenderSupply::kAllData & ~(read | fConsumedData);
+    TString branches = AliTenderSupply::GetESDBranches(unused);
+    if (branches.Length()) {
+      Info("SelectSupplies", "Disabling unused ESD branches: %s", branches.Data());
+      fESDhandler->SetInactiveBranches(branches);
+    }
+  }
 }
 
 //______________________________________________________________________________
@@ -170,7 +216,8 @@ void AliTender::UserExec(Option_t* option)
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
     } 
   }
-  TIter next(fSupplies);
+  if (!fActiveSupplies) SelectSupplies();
+  TIter next(fActiveSupplies);
   AliTenderSupply *supply;
   while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
   fRunChanged = kFALSE;
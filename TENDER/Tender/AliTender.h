@@ -43,6 +43,11 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  UInt_t                    fConsumedData;   // AliTenderSupply::ETenderData used by the downstream wagons
+  Bool_t                    fPruneBranches;  // Disable the ESD branches nobody reads
+  TObjArray                *fActiveSupplies; //! Supplies whose output is consumed (not owned)
+
+  void                      SelectSupplies();
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
@@ -68,6 +73,17 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  /**
+   * Declare which data (AliTenderSupply::ETenderData) the wagons after the tender
+   * use. Supplies not contributing to them, directly or through another supply,
+   * are skipped. Default: all data, i.e. all supplies are run.
+   * @param[in] data Mask of AliTenderSupply::ETenderData
+   * @param[in] prune If true the ESD branches read neither by the active supplies
+   *                  nor by the downstream wagons are not loaded
+   */
+  void                      SetConsumedData(UInt_t data, Bool_t prune=kFALSE) {fConsumedData = data; fPruneBranches = prune;}
+  UInt_t                    GetConsumedData() const {return fConsumedData;}
+  TObjArray                *GetActiveSupplies() const {return fActiveSupplies;}
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
@@ -75,6 +91,6 @@ public:
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif
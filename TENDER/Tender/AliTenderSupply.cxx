@@ -23,7 +23,9 @@ ClassImp(AliTenderSupply)
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply()
                 :TNamed(),
-                 fTender(NULL)
+                 fTender(NULL),
+                 fReadData(kAllData),
+                 fWrittenData(kAllData)
 {
 // Dummy constructor
 }
@@ -31,7 +33,9 @@ AliTenderSupply::AliTenderSupply()
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply(const char* name, const AliTender *tender)
                 :TNamed(name, "ESD analysis tender car"),
-                 fTender(tender)
+                 fTender(tender),
+                 fReadData(kAllData),
+                 fWrittenData(kAllData)
 {
 // Default constructor
 }
@@ -39,7 +43,9 @@ AliTenderSupply::AliTenderSupply(const char* name, const AliTender *tender)
 //______________________________________________________________________________
 AliTenderSupply::AliTenderSupply(const AliTenderSupply &other)
                 :TNamed(other),
-                 fTender(other.fTender)
+                 fTender(other.fTender),
+                 fReadData(other.fReadData),
+                 fWrittenData(other.fWrittenData)
                  
 {
 // Copy constructor
@@ -58,5 +64,25 @@ AliTenderSupply& AliTenderSupply::operator=(const AliTenderSupply &other)
    if (&other == this) return *this;
    TNamed::operator=(other);
    fTender = other.fTender;
+   fReadData = other.fReadData;
+   fWrittenData = other.fWrittenData;
    return *this;
 }
+
+//______________________________________________________________________________
+TString AliTenderSupply::GetESDBranches(UInt_t data)
+{
+// Space separated list of the ESD branches holding the given ETenderData.
+// kPID is stored in the tracks and has no branch of its own.
+   TString branches;
+   if (data & kTracks)       branches += "Tracks ";
+   if (data & kVertices)     branches += "TPCVertex SPDVertex PrimaryVertex SPDPileupVertices TrkPileupVertices ";
+   if (data & kVZERO)        branches += "AliESDVZERO ";
+   if (data & kTZERO)        branches += "AliESDTZERO ";
+   if (data & kTOF)          branches += "AliTOFHeader AliESDTOFCluster AliESDTOFHit AliESDTOFMatch ";
+   if (data & kTRD)          branches += "TrdTracks TrdTracklets AliESDTrdTrigger ";
+   if (data & kCalo)         branches += "CaloClusters EMCALCells PHOSCells EMCALTrigger PHOSTrigger ";
+   if (data & kV0s)          branches += "V0s Cascades Kinks ";
+   if (data & kMultiplicity) branches += "AliMultiplicity ";
+   return branches.Strip(TString::kTrailing);
+}
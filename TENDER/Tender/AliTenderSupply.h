@@ -18,8 +18,26 @@ class AliTender;
 
 class AliTenderSupply : public TNamed {
 
+public:
+enum ETenderData {
+   kNoData       = 0,
+   kTracks       = BIT(0),  // ESD tracks
+   kVertices     = BIT(1),  // primary and pile-up vertices
+   kVZERO        = BIT(2),
+   kTZERO        = BIT(3),
+   kTOF          = BIT(4),  // TOF header and clusters
+   kTRD          = BIT(5),  // TRD tracks, tracklets and trigger
+   kCalo         = BIT(6),  // EMCAL/PHOS clusters, cells and triggers
+   kV0s          = BIT(7),  // V0s, cascades and kinks
+   kMultiplicity = BIT(8),  // SPD tracklets
+   kPID          = BIT(9),  // PID information stored in the tracks
+   kAllData      = BIT(10)-1
+};
+
 protected:
   const AliTender          *fTender;         // Tender car
+  UInt_t                    fReadData;       // ETenderData read by the supply (default: all)
+  UInt_t                    fWrittenData;    // ETenderData modified by the supply (default: all)
   
 public:  
   AliTenderSupply();
@@ -33,7 +51,13 @@ public:
   virtual void              ProcessEvent() = 0;
   
   void                      SetTender(const AliTender *tender) {fTender = tender;}
+
+  // Data dependencies, used by the tender to skip supplies and prune branches
+  void                      SetDataDependencies(UInt_t read, UInt_t written) {fReadData = read; fWrittenData = written;}
+  UInt_t                    GetReadData() const    {return fReadData;}
+  UInt_t                    GetWrittenData() const {return fWrittenData;}
+  static TString            GetESDBranches(UInt_t data);
     
-  ClassDef(AliTenderSupply,1)  // Base class for tender user algorithms
+  ClassDef(AliTenderSupply,2)  // Base class for tender user algorithms
 };
 #endif
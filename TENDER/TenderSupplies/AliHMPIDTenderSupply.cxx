@@ -52,6 +52,7 @@ AliTenderSupply(name,tender)
   //
   // named ctor
   //
+  SetDataDependencies(kTracks, kTracks|kPID);
 }
 
 //_____________________________________________________
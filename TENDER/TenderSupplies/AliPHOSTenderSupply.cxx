@@ -106,6 +106,7 @@ AliPHOSTenderSupply::AliPHOSTenderSupply(const char *name, const AliTender *tend
    for(Int_t mod=0;mod<6;mod++)fPHOSBadMap[mod]=0x0 ;
    for(Int_t ii=0; ii<15; ii++)fL1phase[ii]=0;
    for(Int_t mod=0; mod<5; mod++)fRunByRunCorr[mod]=0.136 ; //Correction contains measured pi0 mass
+   SetDataDependencies(kCalo|kTracks|kVertices, kCalo);
 }
 
 //_____________________________________________________
@@ -48,6 +48,7 @@ AliPIDTenderSupply::AliPIDTenderSupply(const char *name, const AliTender *tender
   //
   // named ctor
   //
+  SetDataDependencies(kTracks|kTOF|kTZERO, kTracks|kPID);
 }
 
 //_____________________________________________________
@@ -67,6 +67,7 @@ AliT0TenderSupply::AliT0TenderSupply(const char *name, const AliTender *tender):
   for(int i=0; i<4; i++) fTimeOffset[i]=0;
   for(int i=0; i<24; i++) fFixMeanCFD[i]=0;
 
+  SetDataDependencies(kTZERO|kVertices, kTZERO);
 }
 
 //________________________________________________________________________
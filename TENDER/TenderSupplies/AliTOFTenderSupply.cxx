@@ -139,6 +139,7 @@ AliTOFTenderSupply::AliTOFTenderSupply(const char *name, const AliTender *tender
   fT0shift[1] = 0;
   fT0shift[2] = 0;
   fT0shift[3] = 0;
+  SetDataDependencies(kTracks|kTOF|kTZERO|kVertices, kTracks|kTOF|kPID);
 }
 
 //_____________________________________________________
@@ -106,6 +106,7 @@ fRecoPass(0)
   //
   // named ctor
   //
+  SetDataDependencies(kTracks|kVertices, kTracks|kPID);
 }
 
 //_____________________________________________________
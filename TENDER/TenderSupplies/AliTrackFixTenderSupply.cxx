@@ -55,6 +55,7 @@ AliTrackFixTenderSupply::AliTrackFixTenderSupply(const char *name, const AliTend
 {
   // named ctor
   //
+  SetDataDependencies(kTracks|kVertices, kTracks);
 }
 
 //_____________________________________________________
@@ -67,6 +67,7 @@ AliVZEROTenderSupply::AliVZEROTenderSupply(const char *name, const AliTender *te
   //
   // named ctor
   //
+  SetDataDependencies(kVZERO, kVZERO);
 }
 
 //_____________________________________________________
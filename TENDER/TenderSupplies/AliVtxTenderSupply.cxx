@@ -53,6 +53,7 @@ AliVtxTenderSupply::AliVtxTenderSupply(const char *name, const AliTender *tender
   //
   // named ctor
   //
+  SetDataDependencies(kTracks|kVertices, kTracks|kVertices);
 }
 
 //_____________________________________________________